@@ -0,0 +1,118 @@
+#
+# Generate the PNP vendor table for XcmEdidVendorName() without CMake.
+#
+#   LC_ALL=C awk -f cmake/XcmPnpIds.awk file1 [file2 ...] > XcmPnpIds.h
+#
+# The files are in hwdata pnp.ids format. Later files win for duplicate
+# IDs. The output is the same as of cmake/XcmPnpIds.cmake; the "pnp-ids-awk"
+# test compares both. src/Makefile.am uses it for the system pnp.ids.
+# LC_ALL=C lets the name offsets count bytes.
+#
+
+function escape( s,    i, c, out )
+{
+  out = ""
+  for(i = 1; i <= length( s ); ++i)
+  {
+    c = substr( s, i, 1 )
+    if(c == "\\" || c == "\"")
+      out = out "\\"
+    out = out c
+  }
+  return out
+}
+
+# A = 1 ... Z = 26
+function letter( i )
+{
+  return index( letters, substr( $0, i, 1 ) ) - 1
+}
+
+BEGIN {
+  letters = "@ABCDEFGHIJKLMNOPQRSTUVWXYZ"
+}
+
+{
+  sub( /\r$/, "" )
+  if($0 !~ /^[A-Z][A-Z][A-Z]\t./)
+    next
+  id = letter( 1 ) * 1024 + letter( 2 ) * 32 + letter( 3 )
+  name = substr( $0, 5 )
+  sub( /^[ \t]+/, "", name )
+  sub( /[ \t]+$/, "", name )
+  names[id] = name
+}
+
+END {
+  pages = 0
+  vendors = 0
+  offset = 0
+  last_page = -1
+  for(id = 0; id < 32768; ++id)
+  {
+    if(!(id in names))
+      continue
+    p = int( id / 32 )
+    if(p != last_page)
+    {
+      page[p] = ++pages
+      last_page = p
+    }
+    slot[pages, id % 32] = ++vendors
+    offsets[vendors] = offset
+    escaped[vendors] = escape( names[id] )
+    offset += length( names[id] ) + 1
+  }
+
+  print "/*  @file XcmPnpIds.h"
+  print " *"
+  print " *  libXcm  Xorg Colour Management"
+  print " *"
+  print " *  @brief    PNP vendor ID table"
+  print " *  @internal"
+  print " *"
+  print " *  Generated by cmake/XcmPnpIds.cmake from pnp.ids - do not edit."
+  print " */"
+  print ""
+  print "#ifndef __XCM_PNP_IDS_H__"
+  print "#define __XCM_PNP_IDS_H__"
+  print ""
+  print "#define XCM_PNP_VENDORS " vendors
+  print "#define XCM_PNP_PAGES " pages
+  print ""
+  print "/* first two letters -> page number + 1, or 0 */"
+  print "static const uint16_t xcm_pnp_page[1024] = {"
+  for(p = 0; p < 1024; ++p)
+  {
+    if(p % 16 == 0)
+      printf "  "
+    printf "%d,", (p in page) ? page[p] : 0
+    if(p % 16 == 15)
+      printf "\n"
+  }
+  print "};"
+  print ""
+  print "/* third letter -> vendor number + 1, or 0 */"
+  print "static const uint16_t xcm_pnp_slot[XCM_PNP_PAGES][32] = {"
+  for(p = 1; p <= pages; ++p)
+  {
+    printf "  {"
+    for(s = 0; s < 32; ++s)
+      printf "%d,", ((p, s) in slot) ? slot[p, s] : 0
+    printf "},\n"
+  }
+  print "};"
+  print ""
+  print "/* vendor number -> offset into xcm_pnp_names */"
+  print "static const uint32_t xcm_pnp_offset[XCM_PNP_VENDORS] = {"
+  for(v = 1; v <= vendors; ++v)
+    print "  " offsets[v] ","
+  print "};"
+  print ""
+  print "static const char xcm_pnp_names[] ="
+  for(v = 1; v <= vendors; ++v)
+    printf "  \"%s\\000\"\n", escaped[v]
+  print ";"
+  print ""
+  print "#endif /* __XCM_PNP_IDS_H__ */"
+}
@@ -0,0 +1,163 @@
+#
+# Generate src/XcmPnpIds.h, the PNP vendor table for XcmEdidVendorName().
+#
+#   cmake [-DPNP_IDS="file1;file2"] [-DOUTPUT=file] [-DCOMPARE=file]
+#         -P cmake/XcmPnpIds.cmake
+#
+# PNP_IDS lists files in hwdata pnp.ids format. Later files win for
+# duplicate IDs. The default is cmake/pnp.ids .
+# With COMPARE the script fails, if OUTPUT differs from that file.
+#
+# src/CMakeLists.txt runs this script for the "pnp-ids" target, which
+# rewrites src/XcmPnpIds.h, for the full table from the system pnp.ids
+# and for the "pnp-ids" test, which compares a fresh copy with
+# src/XcmPnpIds.h . cmake/XcmPnpIds.awk writes the same output for the
+# autotools build.
+#
+# The table is a two level direct index on the 15 bit manufacturer ID:
+# the first two letters select a page, the third letter a slot in it.
+#
+
+IF(NOT PNP_IDS)
+  SET( PNP_IDS "${CMAKE_CURRENT_LIST_DIR}/pnp.ids" )
+ENDIF(NOT PNP_IDS)
+IF(NOT OUTPUT)
+  SET( OUTPUT "${CMAKE_CURRENT_LIST_DIR}/../src/XcmPnpIds.h" )
+ENDIF(NOT OUTPUT)
+
+SET( LETTERS "@ABCDEFGHIJKLMNOPQRSTUVWXYZ" )
+SET( IDS )
+
+FOREACH( PNP_FILE ${PNP_IDS} )
+  FILE( READ "${PNP_FILE}" CONTENT )
+  STRING( REGEX REPLACE ";" "\\\\;" CONTENT "${CONTENT}" )
+  STRING( REGEX REPLACE "\r?\n" ";" LINES "${CONTENT}" )
+  FOREACH( LINE ${LINES} )
+    IF( LINE MATCHES "^([A-Z])([A-Z])([A-Z])\t(.+)$" )
+      STRING( FIND "${LETTERS}" "${CMAKE_MATCH_1}" L1 )
+      STRING( FIND "${LETTERS}" "${CMAKE_MATCH_2}" L2 )
+      STRING( FIND "${LETTERS}" "${CMAKE_MATCH_3}" L3 )
+      SET( NAME "${CMAKE_MATCH_4}" )
+      MATH( EXPR ID "(${L1} << 10) | (${L2} << 5) | ${L3}" )
+      # zero padded for sorting as string
+      STRING( LENGTH "${ID}" LEN )
+      WHILE( LEN LESS 5 )
+        SET( ID "0${ID}" )
+        MATH( EXPR LEN "${LEN} + 1" )
+      ENDWHILE()
+      STRING( STRIP "${NAME}" NAME )
+      STRING( REPLACE "\\" "\\\\" NAME "${NAME}" )
+      STRING( REPLACE "\"" "\\\"" NAME "${NAME}" )
+      SET( NAME_${ID} "${NAME}" )
+      LIST( APPEND IDS ${ID} )
+    ENDIF()
+  ENDFOREACH( LINE )
+ENDFOREACH( PNP_FILE )
+
+LIST( REMOVE_DUPLICATES IDS )
+LIST( SORT IDS )
+
+SET( PAGES 0 )
+SET( VENDORS 0 )
+SET( OFFSET 0 )
+SET( LAST_PAGE -1 )
+SET( OFFSETS_C "" )
+SET( NAMES_C "" )
+FOREACH( ID ${IDS} )
+  SET( NAME "${NAME_${ID}}" )
+  # drop the padding; a REGEX REPLACE on "^0+" would match again after
+  # each replaced zero run
+  MATH( EXPR ID "${ID}" )
+  MATH( EXPR PAGE "${ID} >> 5" )
+  MATH( EXPR SLOT "${ID} & 31" )
+  IF( NOT PAGE EQUAL LAST_PAGE )
+    MATH( EXPR PAGES "${PAGES} + 1" )
+    SET( PAGE_${PAGE} ${PAGES} )
+    SET( LAST_PAGE ${PAGE} )
+  ENDIF()
+  MATH( EXPR VENDORS "${VENDORS} + 1" )
+  SET( SLOT_${PAGES}_${SLOT} ${VENDORS} )
+
+  SET( OFFSETS_C "${OFFSETS_C}  ${OFFSET},\n" )
+  SET( NAMES_C "${NAMES_C}  \"${NAME}\\000\"\n" )
+  # escapes count once in the compiled string
+  STRING( REGEX REPLACE "\\\\(.)" "\\1" RAW "${NAME}" )
+  STRING( LENGTH "${RAW}" LEN )
+  MATH( EXPR OFFSET "${OFFSET} + ${LEN} + 1" )
+ENDFOREACH( ID )
+
+SET( PAGE_C "" )
+FOREACH( PAGE RANGE 0 1023 )
+  MATH( EXPR COL "${PAGE} % 16" )
+  IF( COL EQUAL 0 )
+    SET( PAGE_C "${PAGE_C}  " )
+  ENDIF()
+  IF( DEFINED PAGE_${PAGE} )
+    SET( PAGE_C "${PAGE_C}${PAGE_${PAGE}}," )
+  ELSE()
+    SET( PAGE_C "${PAGE_C}0," )
+  ENDIF()
+  IF( COL EQUAL 15 )
+    SET( PAGE_C "${PAGE_C}\n" )
+  ENDIF()
+ENDFOREACH( PAGE )
+
+SET( SLOT_C "" )
+FOREACH( PAGE RANGE 1 ${PAGES} )
+  SET( SLOT_C "${SLOT_C}  {" )
+  FOREACH( SLOT RANGE 0 31 )
+    IF( DEFINED SLOT_${PAGE}_${SLOT} )
+      SET( SLOT_C "${SLOT_C}${SLOT_${PAGE}_${SLOT}}," )
+    ELSE()
+      SET( SLOT_C "${SLOT_C}0," )
+    ENDIF()
+  ENDFOREACH( SLOT )
+  SET( SLOT_C "${SLOT_C}},\n" )
+ENDFOREACH( PAGE )
+
+FILE( WRITE "${OUTPUT}"
+"/*  @file XcmPnpIds.h
+ *
+ *  libXcm  Xorg Colour Management
+ *
+ *  @brief    PNP vendor ID table
+ *  @internal
+ *
+ *  Generated by cmake/XcmPnpIds.cmake from pnp.ids - do not edit.
+ */
+
+#ifndef __XCM_PNP_IDS_H__
+#define __XCM_PNP_IDS_H__
+
+#define XCM_PNP_VENDORS ${VENDORS}
+#define XCM_PNP_PAGES ${PAGES}
+
+/* first two letters -> page number + 1, or 0 */
+static const uint16_t xcm_pnp_page[1024] = {
+${PAGE_C}};
+
+/* third letter -> vendor number + 1, or 0 */
+static const uint16_t xcm_pnp_slot[XCM_PNP_PAGES][32] = {
+${SLOT_C}};
+
+/* vendor number -> offset into xcm_pnp_names */
+static const uint32_t xcm_pnp_offset[XCM_PNP_VENDORS] = {
+${OFFSETS_C}};
+
+static const char xcm_pnp_names[] =
+${NAMES_C};
+
+#endif /* __XCM_PNP_IDS_H__ */
+" )
+
+MESSAGE( "-- ${VENDORS} PNP IDs in ${PAGES} pages written to ${OUTPUT}" )
+
+# check mode: the shipped table must match its source list
+IF(COMPARE)
+  EXECUTE_PROCESS( COMMAND ${CMAKE_COMMAND} -E compare_files
+                           "${OUTPUT}" "${COMPARE}"
+                   RESULT_VARIABLE DIFFERENT )
+  IF(DIFFERENT)
+    MESSAGE( FATAL_ERROR "${COMPARE} is outdated, rebuild target pnp-ids" )
+  ENDIF(DIFFERENT)
+ENDIF(COMPARE)
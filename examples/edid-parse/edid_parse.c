@@ -5,7 +5,6 @@
 int main(int argc, char ** argv)
 {
   XCM_EDID_ERROR_e err = 0;
-  char * txt = 0;
   FILE * fp = 0;
   void * mem = 0;
   size_t size = 0;
@@ -23,12 +22,11 @@ int main(int argc, char ** argv)
       s = fread(mem, sizeof(char), size, fp);
       fclose (fp);
     }
-    err = XcmEdidPrintString( mem, &txt, malloc );
+    /* the size lets the parser include the extension blocks */
+    err = XcmEdidWriteString( mem, s, XcmEdidWriteFILE, stderr );
     if(err)
       fprintf(stderr, "Error: %s\n", XcmEdidErrorToString(err));
-    else
-      fprintf(stderr, "%s\n", txt);
-    free(txt);
+    free(mem);
   }
 
   return 0;
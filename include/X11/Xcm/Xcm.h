@@ -100,12 +100,25 @@ int XcolorProfileUpload(Display *dpy, XcolorProfile *profile);
 int XcolorProfileDelete(Display *dpy, XcolorProfile *profile);
 
 
+/**
+ *    The XCM_COLOR_REGIONS_START and XCM_COLOR_REGIONS_END macros
+ * are positions for XcolorRegionInsert() before the first and after the last
+ * region of any stack, including a missing property.
+ */
+#define XCM_COLOR_REGIONS_START ((unsigned long) -2)
+#define XCM_COLOR_REGIONS_END ((unsigned long) -1)
+
 /** Function  XcolorRegionInsert
  *  @brief    Inserts the supplied regions into the stack
  *
  * Inserts the supplied regions into the stack at the position 'pos', shifting
  * the existing profiles upwards in the stack. If 'pos' is beyond the stack end,
  * nothing will be done and the function returns '-1'.
+ *
+ * Inserting with 'pos' = XCM_COLOR_REGIONS_START or XCM_COLOR_REGIONS_END does
+ * not read the existing regions. Only the new regions are sent to the server,
+ * which prepends or appends them. The property must then be of type
+ * XA_CARDINAL with format 8, as written by this library.
  */
 int XcolorRegionInsert(Display *dpy, Window win, unsigned long pos, XcolorRegion *region, unsigned long nRegions);
 
@@ -136,6 +149,70 @@ int XcolorRegionDelete(Display *dpy, Window win, unsigned long start, unsigned l
  */
 int XcolorRegionActivate(Display *dpy, Window win, unsigned long start, unsigned long count);
 
+/**
+ *    The XcolorRegionTransaction opaque structure
+ * holds a local copy of the regions of one window. It is created by
+ * XcolorRegionTransactionBegin() with one fetch of the property. Inserts,
+ * deletes and moves change only the copy.
+ * XcolorRegionTransactionCommit() writes it back with one XChangeProperty.
+ * N edits cost two round trips instead of 2N.
+ */
+typedef struct XcolorRegionTransaction_ XcolorRegionTransaction;
+
+/** Function  XcolorRegionTransactionBegin
+ *  @brief    Fetches the regions of a window for local editing
+ *
+ * Returns NULL on failure.
+ */
+XcolorRegionTransaction *XcolorRegionTransactionBegin(Display *dpy, Window win);
+
+/** Function  XcolorRegionTransactionInsert
+ *  @brief    Queues inserting regions
+ *
+ * Works like XcolorRegionInsert() on the local copy, including
+ * XCM_COLOR_REGIONS_START and XCM_COLOR_REGIONS_END. Returns '-1' for a 'pos'
+ * beyond the stack end.
+ */
+int XcolorRegionTransactionInsert(XcolorRegionTransaction *t, unsigned long pos, XcolorRegion *region, unsigned long nRegions);
+
+/** Function  XcolorRegionTransactionDelete
+ *  @brief    Queues deleting regions
+ *
+ * Works like XcolorRegionDelete() on the local copy.
+ */
+int XcolorRegionTransactionDelete(XcolorRegionTransaction *t, unsigned long start, unsigned long count);
+
+/** Function  XcolorRegionTransactionMove
+ *  @brief    Queues moving regions in the stack
+ *
+ * Moves 'count' regions from position 'from' so that they start at position
+ * 'to' after the move. Returns '-1' if either range extends beyond the stack
+ * end.
+ */
+int XcolorRegionTransactionMove(XcolorRegionTransaction *t, unsigned long from, unsigned long count, unsigned long to);
+
+/** Function  XcolorRegionTransactionRegions
+ *  @brief    Gives the local regions
+ *
+ * The array is owned by the transaction and may be modified in place, e.g.
+ * to replace a profile. Its address changes with inserts. 'nRegions' may be
+ * NULL.
+ */
+XcolorRegion *XcolorRegionTransactionRegions(XcolorRegionTransaction *t, unsigned long *nRegions);
+
+/** Function  XcolorRegionTransactionCommit
+ *  @brief    Writes the regions and frees the transaction
+ *
+ * The property is only written, if the regions were changed. With 'activate'
+ * all regions are activated afterwards, like with XcolorRegionActivate().
+ */
+int XcolorRegionTransactionCommit(XcolorRegionTransaction *t, int activate);
+
+/** Function  XcolorRegionTransactionAbort
+ *  @brief    Frees the transaction without writing
+ */
+void XcolorRegionTransactionAbort(XcolorRegionTransaction *t);
+
 /**
  *    The XCM_COLOR_OUTPUTS macro
  * is attached to windows and specifies on which output the window should
@@ -200,6 +277,18 @@ enum {
  */
 int    XcmColorServerCapabilities    ( Display *dpy );
 
+/** Function  XcmPrefetchAtoms
+ *  @brief    interns all specification atoms at once
+ *
+ *  The Xcolor and XcmColorServerCapabilities() functions cache their atoms
+ *  per Display. Without prefetch each atom costs one server round trip on
+ *  its first use. This call interns all missing ones in one request. The
+ *  cache is freed when the display is closed.
+ *
+ *  @return                            0 on success, -1 on failure
+ */
+int    XcmPrefetchAtoms              ( Display *dpy );
+
 /**
  *    The _ICC_DEVICE_PROFILE atom
 The atom will hold a native ICC profile with the exposed device 
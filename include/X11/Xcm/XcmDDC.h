@@ -43,15 +43,278 @@ typedef enum {
   XCM_DDC_NO_FILE,                     /**< @brief fopen failed, permissions? */
   XCM_DDC_PREPARE_FAIL,            /**< @brief setting EEDID adress failed*/
   XCM_DDC_EDID_READ_FAIL,              /**< @brief could not obtain EEDID */
-  XCM_DDC_WRONG_EDID                   /**< @brief wrong EDID header */
+  XCM_DDC_WRONG_EDID,                  /**< @brief wrong EDID header */
+  XCM_DDC_PENDING,                     /**< @brief transaction not finished */
+  XCM_DDC_WRONG_REPLY,                 /**< @brief unexpected DDC/CI reply */
+  XCM_DDC_CHECKSUM,                    /**< @brief DDC/CI checksum mismatch */
+  XCM_DDC_VCP_UNSUPPORTED,             /**< @brief VCP code not supported */
+  XCM_DDC_TIMEOUT                      /**< @brief deadline passed */
 } XCM_DDC_ERROR_e;
 
+/**
+ *  @brief   i2c transfer mode of a device
+ *
+ *  @version libXcm: 0.5.5
+ *  @since   2026/10/17 (libXcm: 0.5.5)
+ *  @date    2026/10/17
+ */
+typedef enum {
+  XCM_DDC_MODE_UNKNOWN,                /**< @brief not yet read */
+  XCM_DDC_MODE_I2C_RDWR,               /**< @brief combined I2C_RDWR */
+  XCM_DDC_MODE_SMBUS,                  /**< @brief I2C_SMBUS block reads */
+  XCM_DDC_MODE_LEGACY                  /**< @brief write, sleep and read */
+} XCM_DDC_MODE_e;
+
+/** @brief adapter can do combined transfers, like I2C_FUNC_I2C */
+#define XCM_DDC_FUNC_I2C               0x00000001
+/** @brief adapter can do I2C block reads, like
+ *  I2C_FUNC_SMBUS_READ_I2C_BLOCK */
+#define XCM_DDC_FUNC_SMBUS_READ_BLOCK  0x04000000
+/** @brief adapter can do plain read and write; always the case, set it
+ *  alone in XcmDDCMockOptions_s::funcs for a adapter without the above */
+#define XCM_DDC_FUNC_PLAIN             0x80000000
+
+/**
+ *  @brief   one message of a combined i2c transfer
+ *
+ *  @version libXcm: 0.5.5
+ *  @since   2026/10/17 (libXcm: 0.5.5)
+ *  @date    2026/10/17
+ */
+typedef struct {
+  int              addr;               /**< @brief 7 bit slave address */
+  int              read;               /**< @brief 1 to read, 0 to write */
+  int              len;                /**< @brief bytes in buf */
+  unsigned char  * buf;                /**< @brief the data */
+} XcmDDCMsg_s;
+
+/**
+ *  @brief   bus access backend
+ *
+ *  All functions but list and open work on the handle returned by open.
+ *  Functions return 0 or, for read and write, the transferred bytes on
+ *  success and -1 on a failure or NAK. A NULL transfer or smbus_read
+ *  function means the backend lacks that transfer mode.
+ *
+ *  @version libXcm: 0.5.5
+ *  @since   2026/10/17 (libXcm: 0.5.5)
+ *  @date    2026/10/17
+ */
+typedef struct {
+  const char     * name;               /**< @brief backend name */
+  void           * user;               /**< @brief passed to list and open */
+  /** @brief mallocd list of all bus device names, like XcmDDClist() */
+  int           (* list)     ( void              * user,
+                               char            *** devices,
+                               int               * count );
+  /** @brief open a bus and report its XCM_DDC_FUNC_* flags */
+  void *        (* open)     ( void              * user,
+                               const char        * device,
+                               unsigned long     * funcs );
+  void          (* close)    ( void              * handle );
+  /** @brief select the slave for read and write */
+  int           (* address)  ( void              * handle,
+                               int                 address,
+                               int                 force );
+  /** @brief combined transfer of all messages */
+  int           (* transfer) ( void              * handle,
+                               XcmDDCMsg_s       * msgs,
+                               int                 n );
+  /** @brief SMBus I2C block read from command of the selected slave */
+  int           (* smbus_read)(void              * handle,
+                               int                 command,
+                               unsigned char     * buf,
+                               int                 len );
+  int           (* write)    ( void              * handle,
+                               const unsigned char * buf,
+                               int                 len );
+  int           (* read)     ( void              * handle,
+                               unsigned char     * buf,
+                               int                 len );
+} XcmDDCTransport_s;
+
+/**
+ *  @brief   behaviour of the mock transport
+ *
+ *  @version libXcm: 0.5.5
+ *  @since   2026/10/17 (libXcm: 0.5.5)
+ *  @date    2026/10/17
+ */
+typedef struct {
+  long             latency_us;         /**< @brief delay of each transfer */
+  int              nak_percent;        /**< @brief transfers answered by NAK */
+  int              corrupt_percent;    /**< @brief reads with a flipped bit */
+  unsigned long    funcs;              /**< @brief XCM_DDC_FUNC_* flags;
+                                            0 for all */
+  unsigned int     seed;               /**< @brief of the random errors */
+  unsigned long    announce;           /**< @brief XCM_DDC_FUNC_* flags
+                                            reported by open; 0 for funcs */
+  long             settle_us;          /**< @brief time a monitor needs
+                                            between accesses; faster
+                                            ones are answered by NAK */
+} XcmDDCMockOptions_s;
+
+/**
+ *  @brief   a monitor connector
+ *
+ *  @version libXcm: 0.5.5
+ *  @since   2026/10/17 (libXcm: 0.5.5)
+ *  @date    2026/10/17
+ */
+typedef struct {
+  char           * name;               /**< @brief e.g. card0-DP-1 */
+  char           * status;             /**< @brief connected, disconnected
+                                            or unknown */
+  char           * device;             /**< @brief i2c device name or NULL */
+  char           * edid;               /**< @brief EDID or NULL */
+  size_t           edid_size;          /**< @brief bytes in edid */
+  int              sysfs;              /**< @brief EDID from the kernel */
+} XcmDDCConnector_s;
+
+/** @brief a opened DDC device */
+typedef struct XcmDDCDevice_s_ XcmDDCDevice_s;
+/** @brief a monitor hotplug listener */
+typedef struct XcmDDCHotplug_s_ XcmDDCHotplug_s;
+/** @brief a non blocking DDC transaction */
+typedef struct XcmDDCTransaction_s_ XcmDDCTransaction_s;
+
+/**
+ *  @brief   a MCCS VCP feature request for XcmDDCVCPBatch()
+ *
+ *  @version libXcm: 0.5.5
+ *  @since   2026/10/17 (libXcm: 0.5.5)
+ *  @date    2026/10/17
+ */
+typedef struct {
+  XcmDDCDevice_s * dev;                /**< @brief the display */
+  unsigned char    code;               /**< @brief VCP code */
+  int              set;                /**< @brief 1 writes value, 0 reads */
+  int              value;              /**< @brief new or current value */
+  int              max;                /**< @brief maximum value, read */
+  int              type;               /**< @brief VCP type byte, read */
+  XCM_DDC_ERROR_e  error;              /**< @brief result */
+} XcmDDCVCP_s;
+
+/**
+ *  @brief   a VCP code of a MCCS capabilities string
+ *
+ *  @version libXcm: 0.5.5
+ *  @since   2026/10/17 (libXcm: 0.5.5)
+ *  @date    2026/10/17
+ */
+typedef struct {
+  unsigned char    code;               /**< @brief VCP code */
+  int              n_values;           /**< @brief 0 for continuous */
+  const unsigned char * values;        /**< @brief allowed values */
+} XcmDDCCapsVCP_s;
+
+/**
+ *  @brief   parsed MCCS capabilities
+ *
+ *  @version libXcm: 0.5.5
+ *  @since   2026/10/17 (libXcm: 0.5.5)
+ *  @date    2026/10/17
+ */
+typedef struct {
+  char           * text;               /**< @brief capabilities string */
+  int              n;                  /**< @brief number of VCP codes */
+  XcmDDCCapsVCP_s * vcp;               /**< @brief the VCP codes */
+} XcmDDCCaps_s;
+
 /* basic access functions */
 XCM_DDC_ERROR_e    XcmDDClist        ( char            *** devices,
                                        int               * count );
+XCM_DDC_ERROR_e    XcmDDClistParallel( char           *** devices,
+                                       int               * count,
+                                       int                 threads,
+                                       int                 timeout_ms );
 XCM_DDC_ERROR_e    XcmDDCgetEDID     ( const char        * device,
                                        char             ** data,
                                        size_t            * size );
+XCM_DDC_ERROR_e    XcmDDCConnectorList(XcmDDCConnector_s ** list,
+                                       int               * count );
+void               XcmDDCConnectorListRelease (
+                                       XcmDDCConnector_s ** list,
+                                       int                 count );
+
+/* hotplug */
+XCM_DDC_ERROR_e    XcmDDCHotplugOpen ( XcmDDCHotplug_s  ** hotplug );
+int                XcmDDCHotplugFd   ( const XcmDDCHotplug_s * hotplug );
+XCM_DDC_ERROR_e    XcmDDCHotplugRead ( XcmDDCHotplug_s   * hotplug,
+                                       XcmDDCConnector_s ** changed,
+                                       int               * count );
+void               XcmDDCHotplugRelease(XcmDDCHotplug_s ** hotplug );
+
+/* device handles */
+XCM_DDC_ERROR_e    XcmDDCDeviceOpen  ( const char        * device,
+                                       XcmDDCDevice_s   ** dev );
+XCM_DDC_ERROR_e    XcmDDCPoolGet     ( const char        * device,
+                                       XcmDDCDevice_s   ** dev );
+void               XcmDDCPoolClear   ( void );
+void               XcmDDCDeviceRelease(XcmDDCDevice_s   ** dev );
+const char *       XcmDDCDeviceName  ( const XcmDDCDevice_s * dev );
+XCM_DDC_MODE_e     XcmDDCDeviceMode  ( XcmDDCDevice_s    * dev,
+                                       long              * read_us );
+const char *       XcmDDCModeToString( XCM_DDC_MODE_e      mode );
+void               XcmDDCDeviceTiming( XcmDDCDevice_s    * dev,
+                                       long              * delay_us,
+                                       unsigned long     * backoffs );
+void               XcmDDCTimingCache ( const char        * file_name );
+XCM_DDC_ERROR_e    XcmDDCDeviceGetEDID(XcmDDCDevice_s    * dev,
+                                       char             ** data,
+                                       size_t            * size );
+
+/* EDID cache */
+void               XcmDDCEDIDCache   ( int                 enable );
+void               XcmDDCEDIDCacheGeneration (
+                                       unsigned long       generation );
+void               XcmDDCEDIDCacheStats (
+                                       unsigned long     * hits,
+                                       unsigned long     * misses );
+
+/* non blocking access */
+XCM_DDC_ERROR_e    XcmDDCDeviceEDIDStart (
+                                       XcmDDCDevice_s    * dev,
+                                       XcmDDCTransaction_s ** t );
+XCM_DDC_ERROR_e    XcmDDCEDIDStart   ( const char        * device,
+                                       XcmDDCTransaction_s ** t );
+int                XcmDDCTransactionFd(const XcmDDCTransaction_s * t );
+int                XcmDDCTransactionTimeout (
+                                       const XcmDDCTransaction_s * t );
+XCM_DDC_ERROR_e    XcmDDCTransactionStep (
+                                       XcmDDCTransaction_s * t );
+XCM_DDC_ERROR_e    XcmDDCTransactionGetEDID (
+                                       XcmDDCTransaction_s * t,
+                                       char             ** data,
+                                       size_t            * size );
+void               XcmDDCTransactionRelease (
+                                       XcmDDCTransaction_s ** t );
+
+/* DDC/CI MCCS */
+XCM_DDC_ERROR_e    XcmDDCGetVCP      ( XcmDDCDevice_s    * dev,
+                                       unsigned char       code,
+                                       int               * value,
+                                       int               * max );
+XCM_DDC_ERROR_e    XcmDDCSetVCP      ( XcmDDCDevice_s    * dev,
+                                       unsigned char       code,
+                                       int                 value );
+XCM_DDC_ERROR_e    XcmDDCVCPBatch    ( XcmDDCVCP_s       * features,
+                                       int                 n );
+XCM_DDC_ERROR_e    XcmDDCGetCapabilities (
+                                       XcmDDCDevice_s    * dev,
+                                       const XcmDDCCaps_s ** caps );
+void               XcmDDCSetCapabilitiesCache (
+                                       const char        * file_name );
+void               XcmDDCClearCapabilities ( void );
+
+/* transport */
+const XcmDDCTransport_s * XcmDDCTransportLinux ( void );
+void               XcmDDCSetTransport( const XcmDDCTransport_s * transport );
+XcmDDCTransport_s * XcmDDCTransportMockNew (
+                                       const char        * directory,
+                                       const XcmDDCMockOptions_s * options );
+void               XcmDDCTransportMockFree (
+                                       XcmDDCTransport_s ** transport );
 
 const char *   XcmDDCErrorToString   ( XCM_DDC_ERROR_e     error );
 
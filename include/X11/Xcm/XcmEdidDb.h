@@ -0,0 +1,135 @@
+/** XcmEdidDb.h
+ *
+ *  Xcm Xorg Colour Management
+ *
+ *  @par Copyright:
+ *            2026 (C) Kai-Uwe Behrmann
+ *
+ *  @brief    binary data base of parsed EDID blocks
+ *  @internal
+ *  @author   Kai-Uwe Behrmann <ku.b@gmx.de>
+ *  @par License:
+ *            MIT <http://www.opensource.org/licenses/mit-license.php>
+ *  @since    2026/10/17
+ */
+
+#ifndef XCM_EDID_DB_H
+#define XCM_EDID_DB_H
+#include <stddef.h> /* size_t */
+#include <stdint.h>
+
+#include "XcmEdidParse.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/** \addtogroup XcmEdidParse
+ *
+ *  @{
+ */
+
+/** @brief file magic of a XcmEdidDb file */
+#define XCM_EDID_DB_MAGIC                 "XCMEDIDB"
+/** @brief format version of XcmEdidDbHeader_s and XcmEdidRecord_s */
+#define XCM_EDID_DB_VERSION               1
+/** @brief written as is to detect the byte order of the file */
+#define XCM_EDID_DB_BYTE_ORDER            0x01020304
+
+/**
+ *  @brief   XcmEdidDb file header
+ *
+ *  The header is followed by count records at records_offset and the
+ *  string table at strings_offset. All values use the byte order of the
+ *  writing host.
+ *
+ *  @version libXcm: 0.5.5
+ *  @since   2026/10/17 (libXcm: 0.5.5)
+ *  @date    2026/10/17
+ */
+typedef struct {
+  char     magic[8];                   /**< @brief XCM_EDID_DB_MAGIC */
+  uint32_t version;                    /**< @brief XCM_EDID_DB_VERSION */
+  uint32_t byte_order;                 /**< @brief XCM_EDID_DB_BYTE_ORDER */
+  uint32_t header_size;                /**< @brief sizeof(XcmEdidDbHeader_s) */
+  uint32_t record_size;                /**< @brief sizeof(XcmEdidRecord_s) */
+  uint64_t count;                      /**< @brief number of records */
+  uint64_t records_offset;             /**< @brief file offset of records */
+  uint64_t strings_offset;             /**< @brief file offset of strings */
+  uint64_t strings_size;               /**< @brief bytes in string table */
+  uint8_t  reserved[8];
+} XcmEdidDbHeader_s;
+
+/**
+ *  @brief   fixed layout record of one parsed EDID
+ *
+ *  The fields follow XcmEdidInfo_s. Text fields are offsets into the
+ *  string table; offset 0 is the empty string.
+ *
+ *  @version libXcm: 0.5.5
+ *  @since   2026/10/17 (libXcm: 0.5.5)
+ *  @date    2026/10/17
+ */
+typedef struct {
+  uint32_t flags;                      /**< @brief XCM_EDID_INFO_ bits */
+  uint32_t vendor;                     /**< @brief string offset */
+  uint32_t model;                      /**< @brief string offset */
+  uint32_t serial;                     /**< @brief string offset */
+  uint32_t mnft;                       /**< @brief string offset */
+  uint32_t manufacturer;               /**< @brief string offset */
+  int32_t  mnft_id;
+  int32_t  model_id;
+  int32_t  week;
+  int32_t  year;
+  int32_t  extensions;
+  int32_t  eotf;
+  int32_t  colorimetry;
+  int32_t  video_capability;
+  uint32_t reserved[2];
+  double   red_x, red_y;
+  double   green_x, green_y;
+  double   blue_x, blue_y;
+  double   white_x, white_y;
+  double   gamma;
+  double   a3red, a2red;
+  double   a3green, a2green;
+  double   a3blue, a2blue;
+  double   max_luminance;
+  double   max_frame_avg_luminance;
+  double   min_luminance;
+} XcmEdidRecord_s;
+
+/** @brief collects records for a XcmEdidDb file */
+typedef struct XcmEdidDbWriter_s_ XcmEdidDbWriter_s;
+/** @brief a mapped XcmEdidDb file */
+typedef struct XcmEdidDb_s_ XcmEdidDb_s;
+
+XcmEdidDbWriter_s *
+                  XcmEdidDbWriter_New( void );
+XCM_EDID_ERROR_e  XcmEdidDbWriter_Add( XcmEdidDbWriter_s * w,
+                                       const XcmEdidInfo_s * info );
+XCM_EDID_ERROR_e  XcmEdidDbWriter_Save(XcmEdidDbWriter_s * w,
+                                       const char        * file_name );
+void              XcmEdidDbWriter_Release (
+                                       XcmEdidDbWriter_s** w );
+
+XCM_EDID_ERROR_e  XcmEdidDb_Open     ( const char        * file_name,
+                                       XcmEdidDb_s      ** db );
+size_t            XcmEdidDb_Count    ( const XcmEdidDb_s * db );
+const XcmEdidRecord_s *
+                  XcmEdidDb_Get      ( const XcmEdidDb_s * db,
+                                       size_t              pos );
+const char *      XcmEdidDb_String   ( const XcmEdidDb_s * db,
+                                       uint32_t            offset );
+XCM_EDID_ERROR_e  XcmEdidDb_GetInfo  ( const XcmEdidDb_s * db,
+                                       size_t              pos,
+                                       XcmEdidInfo_s     * out );
+void              XcmEdidDb_Release  ( XcmEdidDb_s      ** db );
+
+/* @} XcmEdidParse */
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif /* __cplusplus */
+
+#endif /* XCM_EDID_DB_H */
@@ -16,6 +16,7 @@
 #ifndef XCM_EDID_PARSE_H
 #define XCM_EDID_PARSE_H
 #include <stddef.h> /* size_t */
+#include <stdint.h> /* uint16_t */
 
 #ifdef __cplusplus
 extern "C" {
@@ -66,7 +67,12 @@ typedef struct {
 
 typedef enum {
   XCM_EDID_OK,
-  XCM_EDID_WRONG_SIGNATURE
+  XCM_EDID_WRONG_SIGNATURE,            /**< @brief no EDID or DisplayID */
+  XCM_EDID_WRONG_SIZE,                 /**< @brief data block too small */
+  XCM_EDID_WRITE_FAIL,
+  XCM_EDID_FILE_FAIL,
+  XCM_EDID_WRONG_ARGUMENT,             /**< @brief a needed pointer is NULL */
+  XCM_EDID_NO_MEMORY                   /**< @brief allocation failed */
 } XCM_EDID_ERROR_e;
 
 typedef enum {
@@ -81,17 +87,162 @@ union XcmEdidValue_u {
   int    integer;
 };
 
+/**
+ *  @brief   key IDs for XcmEdidGet()
+ *
+ *  Each ID corresponds to the XCM_EDID_KEY_ macro of the same name.
+ *
+ *  @version libXcm: 0.5.5
+ *  @since   2026/10/17 (libXcm: 0.5.5)
+ *  @date    2026/10/17
+ */
+typedef enum {
+  XCM_EDID_ID_VENDOR,
+  XCM_EDID_ID_MODEL,
+  XCM_EDID_ID_SERIAL,
+  XCM_EDID_ID_REDx,
+  XCM_EDID_ID_REDy,
+  XCM_EDID_ID_GREENx,
+  XCM_EDID_ID_GREENy,
+  XCM_EDID_ID_BLUEx,
+  XCM_EDID_ID_BLUEy,
+  XCM_EDID_ID_WHITEx,
+  XCM_EDID_ID_WHITEy,
+  XCM_EDID_ID_GAMMA,
+  XCM_EDID_ID_WEEK,
+  XCM_EDID_ID_YEAR,
+  XCM_EDID_ID_MNFT_ID,
+  XCM_EDID_ID_MODEL_ID,
+  XCM_EDID_ID_MNFT,
+  XCM_EDID_ID_MANUFACTURER,
+  XCM_EDID_ID_A3RED,
+  XCM_EDID_ID_A2RED,
+  XCM_EDID_ID_A3GREEN,
+  XCM_EDID_ID_A2GREEN,
+  XCM_EDID_ID_A3BLUE,
+  XCM_EDID_ID_A2BLUE,
+  XCM_EDID_ID_EOTF,
+  XCM_EDID_ID_MAX_LUMINANCE,
+  XCM_EDID_ID_MAX_FALL,
+  XCM_EDID_ID_MIN_LUMINANCE,
+  XCM_EDID_ID_COLORIMETRY,
+  XCM_EDID_ID_VIDEO_CAPABILITY,
+  XCM_EDID_ID_COUNT                    /**< @brief number of IDs, no key */
+} XCM_EDID_ID_e;
+
 typedef struct {
   const char         * key;
   XCM_EDID_VALUE_e        type;
   union XcmEdidValue_u   value;
 } XcmEdidKeyValue_s;
 
+/** @brief XcmEdidInfo_s::flags bits for optional fields */
+enum {
+  XCM_EDID_INFO_VENDOR = 0x01,         /**< @brief vendor text was found */
+  XCM_EDID_INFO_MODEL = 0x02,          /**< @brief model text was found */
+  XCM_EDID_INFO_SERIAL = 0x04,         /**< @brief serial text was found */
+  XCM_EDID_INFO_CMD = 0x08,            /**< @brief a3/a2 CMD values are set */
+  XCM_EDID_INFO_EOTF = 0x10,           /**< @brief CEA HDR static metadata */
+  XCM_EDID_INFO_MAX_LUMINANCE = 0x20,  /**< @brief max_luminance is set */
+  XCM_EDID_INFO_MAX_FALL = 0x40,       /**< @brief max_frame_avg_luminance */
+  XCM_EDID_INFO_MIN_LUMINANCE = 0x80,  /**< @brief min_luminance is set */
+  XCM_EDID_INFO_COLORIMETRY = 0x100,   /**< @brief CEA colorimetry block */
+  XCM_EDID_INFO_VIDEO_CAPABILITY = 0x200, /**< @brief CEA video capability */
+  XCM_EDID_INFO_DISPLAYID = 0x400      /**< @brief DisplayID display parameters */
+};
+
+/** @brief XcmEdidInfo_s::eotf bits from the CEA-861 HDR static metadata */
+enum {
+  XCM_EDID_EOTF_SDR = 0x01,            /**< @brief traditional gamma SDR */
+  XCM_EDID_EOTF_HDR = 0x02,            /**< @brief traditional gamma HDR */
+  XCM_EDID_EOTF_PQ = 0x04,             /**< @brief SMPTE ST 2084 */
+  XCM_EDID_EOTF_HLG = 0x08             /**< @brief hybrid log gamma */
+};
+
+/** @brief XcmEdidInfo_s::colorimetry bits from the CEA-861 colorimetry
+ *  data block; the low byte is the first, the high byte the second byte */
+enum {
+  XCM_EDID_COLORIMETRY_XVYCC601 = 0x01,
+  XCM_EDID_COLORIMETRY_XVYCC709 = 0x02,
+  XCM_EDID_COLORIMETRY_SYCC601 = 0x04,
+  XCM_EDID_COLORIMETRY_OPYCC601 = 0x08,
+  XCM_EDID_COLORIMETRY_OPRGB = 0x10,
+  XCM_EDID_COLORIMETRY_BT2020CYCC = 0x20,
+  XCM_EDID_COLORIMETRY_BT2020YCC = 0x40,
+  XCM_EDID_COLORIMETRY_BT2020RGB = 0x80,
+  XCM_EDID_COLORIMETRY_DCIP3 = 0x8000
+};
+
+/**
+ *  @brief   fixed size result of XcmEdidParseInto()
+ *
+ *  All text is stored inline, so the structure can live on the stack or
+ *  inside a caller array without any further memory management.
+ *
+ *  @version libXcm: 0.5.5
+ *  @since   2026/10/17 (libXcm: 0.5.5)
+ *  @date    2026/10/17
+ */
+typedef struct {
+  char     vendor[16];                 /**< @brief vendor text, see flags */
+  char     model[16];                  /**< @brief model text or model_id */
+  char     serial[16];                 /**< @brief serial text, see flags */
+  char     mnft[4];                    /**< @brief three letter PNP ID */
+  char     manufacturer[80];           /**< @brief full manufacturer name */
+  int      mnft_id;                    /**< @brief manufacturer ID */
+  int      model_id;                   /**< @brief model ID */
+  int      week;                       /**< @brief manufacture week */
+  int      year;                       /**< @brief manufacture year */
+  double   red_x, red_y;               /**< @brief CIE*xyY primary red */
+  double   green_x, green_y;           /**< @brief CIE*xyY primary green */
+  double   blue_x, blue_y;             /**< @brief CIE*xyY primary blue */
+  double   white_x, white_y;           /**< @brief CIE*xyY white point */
+  double   gamma;                      /**< @brief single gamma, -1 if unset */
+  double   a3red, a2red;               /**< @brief CMD red transfer */
+  double   a3green, a2green;           /**< @brief CMD green transfer */
+  double   a3blue, a2blue;             /**< @brief CMD blue transfer */
+  int      flags;                      /**< @brief XCM_EDID_INFO_ bits */
+  int      extensions;                 /**< @brief parsed extension blocks */
+  int      eotf;                       /**< @brief XCM_EDID_EOTF_ bits */
+  int      colorimetry;                /**< @brief XCM_EDID_COLORIMETRY_ bits */
+  int      video_capability;           /**< @brief CEA video capability byte */
+  double   max_luminance;              /**< @brief desired content max, cd/m² */
+  double   max_frame_avg_luminance;    /**< @brief max frame-average, cd/m² */
+  double   min_luminance;              /**< @brief desired content min, cd/m² */
+} XcmEdidInfo_s;
+
 /* basic access functions */
+XCM_EDID_ERROR_e  XcmEdidParseInto   ( const void        * edid,
+                                       size_t              size,
+                                       XcmEdidInfo_s     * out );
 XCM_EDID_ERROR_e  XcmEdidParse        ( void              * edid,
                                        XcmEdidKeyValue_s** list,
                                        int               * count );
+XCM_EDID_ERROR_e  XcmEdidParseSized  ( const void        * edid,
+                                       size_t              size,
+                                       XcmEdidKeyValue_s** list,
+                                       int               * count );
 XCM_EDID_ERROR_e  XcmEdidFree        ( XcmEdidKeyValue_s** list );
+const XcmEdidKeyValue_s * XcmEdidGet ( const XcmEdidKeyValue_s * list,
+                                       XCM_EDID_ID_e       id );
+XCM_EDID_ERROR_e  XcmEdidParseBatch  ( const void *const * edids,
+                                       const size_t      * sizes,
+                                       int                 n,
+                                       XcmEdidInfo_s     * out,
+                                       XCM_EDID_ERROR_e  * errors,
+                                       int                 threads );
+XCM_EDID_ERROR_e  XcmEdidParseBlocks ( const void        * blocks,
+                                       size_t              stride,
+                                       int                 n,
+                                       XcmEdidInfo_s     * out,
+                                       XCM_EDID_ERROR_e  * errors,
+                                       int                 threads );
+XCM_EDID_ERROR_e  XcmEdidDecodeChromaticity (
+                                       const void        * blocks,
+                                       size_t              stride,
+                                       int                 n,
+                                       double            * colors );
+const char *      XcmEdidVendorName  ( uint16_t            mnft_id );
 const char *      XcmEdidErrorToString(XCM_EDID_ERROR_e    error );
 
 /* convinience functions */
@@ -101,6 +252,21 @@ XCM_EDID_ERROR_e  XcmEdidPrintString ( void              * edid,
 XCM_EDID_ERROR_e  XcmEdidPrintOpenIccJSON ( void              * edid,
                                        char             ** text,
                                        void             *(*alloc)(size_t sz) );
+/** @brief text sink for streaming output; return non zero to stop */
+typedef int     (*XcmEdidWrite_f)    ( void              * user_data,
+                                       const char        * text,
+                                       size_t              len );
+XCM_EDID_ERROR_e  XcmEdidWriteString ( void              * edid,
+                                       size_t              size,
+                                       XcmEdidWrite_f      write,
+                                       void              * user_data );
+XCM_EDID_ERROR_e  XcmEdidWriteOpenIccJSON ( void         * edid,
+                                       size_t              size,
+                                       XcmEdidWrite_f      write,
+                                       void              * user_data );
+int               XcmEdidWriteFILE   ( void              * fp,
+                                       const char        * text,
+                                       size_t              len );
 /** full length vendor, string */
 #define XCM_EDID_KEY_VENDOR               "vendor"
 /** full length device model, string */
@@ -149,6 +315,18 @@ XCM_EDID_ERROR_e  XcmEdidPrintOpenIccJSON ( void              * edid,
 #define XCM_EDID_KEY_A3BLUE               "a3blue"
 /** transfer value for blue component, double */
 #define XCM_EDID_KEY_A2BLUE               "a2blue"
+/** supported HDR transfer functions, XCM_EDID_EOTF_ bits, integer */
+#define XCM_EDID_KEY_EOTF                 "eotf"
+/** desired content max luminance in cd/m², double */
+#define XCM_EDID_KEY_MAX_LUMINANCE        "max_luminance"
+/** desired content max frame-average luminance in cd/m², double */
+#define XCM_EDID_KEY_MAX_FALL             "max_frame_avg_luminance"
+/** desired content min luminance in cd/m², double */
+#define XCM_EDID_KEY_MIN_LUMINANCE        "min_luminance"
+/** supported colorimetry, XCM_EDID_COLORIMETRY_ bits, integer */
+#define XCM_EDID_KEY_COLORIMETRY          "colorimetry"
+/** CEA-861 video capability flags, integer */
+#define XCM_EDID_KEY_VIDEO_CAPABILITY     "video_capability"
 
 /* @} XcmEdidParse */
 
@@ -17,11 +17,156 @@
 
 #include <Xcm.h>
 #include <stdio.h>
+#include <pthread.h>
+#include <X11/Xlibint.h>  /* XESetCloseDisplay() */
 #include "XcmEvents.h"
 
 extern int * xcm_debug;
 extern XcmMessage_f XcmMessage_p;
 
+/* per Display atom cache */
+
+typedef enum {
+  XCM_ATOM_COLOR_PROFILES,
+  XCM_ATOM_COLOR_REGIONS,
+  XCM_ATOM_COLOR_MANAGEMENT,
+  XCM_ATOM_COLOR_DESKTOP,
+  XCM_ATOM_COLOR_OUTPUTS,
+  XCM_ATOM_DEVICE_PROFILE,
+  XCM_ATOM_N
+} xcmAtom_e;
+
+static const char * xcm_atom_names[XCM_ATOM_N] = {
+  XCM_COLOR_PROFILES,
+  XCM_COLOR_REGIONS,
+  "_ICC_COLOR_MANAGEMENT",
+  XCM_COLOR_DESKTOP,
+  XCM_COLOR_OUTPUTS,
+  XCM_DEVICE_PROFILE
+};
+
+typedef struct xcmDisplayAtoms_s_ {
+  Display          * dpy;
+  Atom               atoms[XCM_ATOM_N]; /* None until interned */
+  struct xcmDisplayAtoms_s_ * next;
+} xcmDisplayAtoms_s;
+
+static pthread_mutex_t xcm_atoms_lock = PTHREAD_MUTEX_INITIALIZER;
+static xcmDisplayAtoms_s * xcm_atoms = NULL;
+
+/* drop the cache of a closing display */
+static int   xcmAtomsCloseDisplay    ( Display           * dpy,
+                                       XExtCodes         * codes )
+{
+  xcmDisplayAtoms_s ** d, * found = NULL;
+
+  (void)codes;
+  pthread_mutex_lock( &xcm_atoms_lock );
+  for(d = &xcm_atoms; *d; d = &(*d)->next)
+    if((*d)->dpy == dpy)
+    {
+      found = *d;
+      *d = found->next;
+      break;
+    }
+  pthread_mutex_unlock( &xcm_atoms_lock );
+  free( found );
+
+  return 0;
+}
+
+/* copy the cached atoms of dpy; creates the cache on first use */
+static int   xcmAtomsGet             ( Display           * dpy,
+                                       Atom              * atoms )
+{
+  xcmDisplayAtoms_s * d;
+
+  pthread_mutex_lock( &xcm_atoms_lock );
+  for(d = xcm_atoms; d; d = d->next)
+    if(d->dpy == dpy)
+      break;
+  if(!d)
+  {
+    XExtCodes * codes;
+
+    d = calloc( 1, sizeof(xcmDisplayAtoms_s) );
+    codes = d ? XAddExtension( dpy ) : NULL;
+    if(!codes)
+    {
+      pthread_mutex_unlock( &xcm_atoms_lock );
+      free( d );
+      return -1;
+    }
+    XESetCloseDisplay( dpy, codes->extension, xcmAtomsCloseDisplay );
+    d->dpy = dpy;
+    d->next = xcm_atoms;
+    xcm_atoms = d;
+  }
+  memcpy( atoms, d->atoms, sizeof(d->atoms) );
+  pthread_mutex_unlock( &xcm_atoms_lock );
+
+  return 0;
+}
+
+static void  xcmAtomsSet             ( Display           * dpy,
+                                       const Atom        * atoms )
+{
+  xcmDisplayAtoms_s * d;
+  int i;
+
+  pthread_mutex_lock( &xcm_atoms_lock );
+  for(d = xcm_atoms; d; d = d->next)
+    if(d->dpy == dpy)
+    {
+      for(i = 0; i < XCM_ATOM_N; ++i)
+        if(atoms[i] != None)
+          d->atoms[i] = atoms[i];
+      break;
+    }
+  pthread_mutex_unlock( &xcm_atoms_lock );
+}
+
+/* a spec atom, interned at most once per display */
+static Atom  xcmAtom                 ( Display           * dpy,
+                                       xcmAtom_e           atom )
+{
+  Atom atoms[XCM_ATOM_N];
+
+  if(xcmAtomsGet( dpy, atoms ) != 0)
+    return XInternAtom( dpy, xcm_atom_names[atom], False );
+
+  if(atoms[atom] == None)
+  {
+    memset( atoms, 0, sizeof(atoms) );
+    atoms[atom] = XInternAtom( dpy, xcm_atom_names[atom], False );
+    xcmAtomsSet( dpy, atoms );
+  }
+
+  return atoms[atom];
+}
+
+int    XcmPrefetchAtoms              ( Display           * dpy )
+{
+  Atom atoms[XCM_ATOM_N];
+  int i, missing = 0;
+
+  if(xcmAtomsGet( dpy, atoms ) != 0)
+    return -1;
+
+  for(i = 0; i < XCM_ATOM_N; ++i)
+    if(atoms[i] == None)
+      ++missing;
+  if(!missing)
+    return 0;
+
+  /* one round trip for all */
+  if(!XInternAtoms( dpy, (char**)xcm_atom_names, XCM_ATOM_N, False, atoms ))
+    return -1;
+  xcmAtomsSet( dpy, atoms );
+
+  return 0;
+}
+
 int  XcmChangeProperty_              ( Display           * dpy,
                                        Window              win,
                                        Atom                atom,
@@ -40,7 +185,7 @@ int XcolorProfileUpload(Display *dpy, XcolorProfile *profile)
 	uint32_t length = htonl(profile->length);
         int i;
 
-	Atom netColorProfiles = XInternAtom(dpy, XCM_COLOR_PROFILES, False);
+	Atom netColorProfiles = xcmAtom(dpy, XCM_ATOM_COLOR_PROFILES);
 
 	for (i = 0; i < ScreenCount(dpy); ++i) {
 		XcmChangeProperty_(dpy, XRootWindow(dpy, i), netColorProfiles, PropModeAppend, (unsigned char *) profile, sizeof(XcolorProfile) + length);
@@ -51,7 +196,7 @@ int XcolorProfileUpload(Display *dpy, XcolorProfile *profile)
 
 int XcolorProfileDelete(Display *dpy, XcolorProfile *profile)
 {
-	Atom netColorProfiles = XInternAtom(dpy, XCM_COLOR_PROFILES, False);
+	Atom netColorProfiles = xcmAtom(dpy, XCM_ATOM_COLOR_PROFILES);
         int i;
 
 	/* To delete a profile, send the header with a zero-length. */
@@ -68,12 +213,20 @@ int XcolorProfileDelete(Display *dpy, XcolorProfile *profile)
 
 int XcolorRegionInsert(Display *dpy, Window win, unsigned long pos, XcolorRegion *region, unsigned long nRegions)
 {
-	Atom netColorRegions = XInternAtom(dpy, XCM_COLOR_REGIONS, False);
+	Atom netColorRegions = xcmAtom(dpy, XCM_ATOM_COLOR_REGIONS);
 	XcolorRegion *ptr;
 	int result;
 
 	unsigned long nRegs;
-	XcolorRegion *reg = XcolorRegionFetch(dpy, win, &nRegs);
+	XcolorRegion *reg;
+
+	/* The explicit stack start and end are valid positions for any stack
+	 * size. The server can extend the property in place. A plain 'pos' = 0
+	 * goes the checked way below, as it did before. */
+	if (pos == XCM_COLOR_REGIONS_START || pos == XCM_COLOR_REGIONS_END)
+		return !XcmChangeProperty_(dpy, win, netColorRegions, pos == XCM_COLOR_REGIONS_END ? PropModeAppend : PropModePrepend, (unsigned char *) region, nRegions * sizeof(XcolorRegion));
+
+	reg = XcolorRegionFetch(dpy, win, &nRegs);
 
 	/* Security check to ensure that the client doesn't try to insert the regions
 	 * to a position beyond the stack end. */
@@ -93,7 +246,7 @@ int XcolorRegionInsert(Display *dpy, Window win, unsigned long pos, XcolorRegion
 	if (nRegs)
 	{
 		memcpy(ptr, reg, nRegs * sizeof(XcolorRegion));
-		memmove(ptr + pos + nRegs, ptr + pos, nRegions * sizeof(XcolorRegion));
+		memmove(ptr + pos + nRegions, ptr + pos, (nRegs - pos) * sizeof(XcolorRegion));
 	}
 	memcpy(ptr + pos, region, nRegions * sizeof(XcolorRegion));
 
@@ -109,7 +262,7 @@ int XcolorRegionInsert(Display *dpy, Window win, unsigned long pos, XcolorRegion
 XcolorRegion *XcolorRegionFetch(Display *dpy, Window win, unsigned long *nRegions)
 {
 
-	Atom actual, netColorRegions = XInternAtom(dpy, XCM_COLOR_REGIONS, False);
+	Atom actual, netColorRegions = xcmAtom(dpy, XCM_ATOM_COLOR_REGIONS);
 
 	unsigned long left, nBytes;
 	unsigned char *data;
@@ -127,7 +280,7 @@ XcolorRegion *XcolorRegionFetch(Display *dpy, Window win, unsigned long *nRegion
 
 int XcolorRegionDelete(Display *dpy, Window win, unsigned long start, unsigned long count)
 {
-	Atom netColorRegions = XInternAtom(dpy, XCM_COLOR_REGIONS, False);
+	Atom netColorRegions = xcmAtom(dpy, XCM_ATOM_COLOR_REGIONS);
 	int result;
 
 	unsigned long nRegions;
@@ -165,7 +318,7 @@ int XcolorRegionActivate(Display *dpy, Window win, unsigned long start, unsigned
 
 	event.type = ClientMessage;
 	event.window = win;
-	event.message_type = XInternAtom(dpy, "_ICC_COLOR_MANAGEMENT", False);
+	event.message_type = xcmAtom(dpy, XCM_ATOM_COLOR_MANAGEMENT);
 	event.format = 32;
 
 	event.data.l[0] = start;
@@ -183,6 +336,157 @@ int XcolorRegionActivate(Display *dpy, Window win, unsigned long start, unsigned
 	return result;
 }
 
+struct XcolorRegionTransaction_ {
+	Display *dpy;
+	Window win;
+	XcolorRegion *regs;
+	unsigned long nRegs;
+	unsigned long allocated;
+	int changed;
+};
+
+XcolorRegionTransaction *XcolorRegionTransactionBegin(Display *dpy, Window win)
+{
+	XcolorRegionTransaction *t = calloc(1, sizeof(XcolorRegionTransaction));
+	XcolorRegion *reg;
+	unsigned long nRegs;
+
+	if (t == NULL)
+		return NULL;
+
+	t->dpy = dpy;
+	t->win = win;
+
+	/* The only read of the transaction. */
+	reg = XcolorRegionFetch(dpy, win, &nRegs);
+	if (nRegs) {
+		t->regs = malloc(nRegs * sizeof(XcolorRegion));
+		if (t->regs == NULL) {
+			XFree(reg);
+			free(t);
+			return NULL;
+		}
+		memcpy(t->regs, reg, nRegs * sizeof(XcolorRegion));
+		t->nRegs = t->allocated = nRegs;
+	}
+	if (reg)
+		XFree(reg);
+
+	return t;
+}
+
+int XcolorRegionTransactionInsert(XcolorRegionTransaction *t, unsigned long pos, XcolorRegion *region, unsigned long nRegions)
+{
+	if (t == NULL)
+		return -1;
+	if (pos == XCM_COLOR_REGIONS_START)
+		pos = 0;
+	else if (pos == XCM_COLOR_REGIONS_END)
+		pos = t->nRegs;
+	if (pos > t->nRegs)
+		return -1;
+
+	if (t->nRegs + nRegions > t->allocated) {
+		unsigned long allocated = t->allocated * 2;
+		XcolorRegion *regs;
+
+		if (allocated < t->nRegs + nRegions)
+			allocated = t->nRegs + nRegions;
+		regs = realloc(t->regs, allocated * sizeof(XcolorRegion));
+		if (regs == NULL)
+			return -1;
+		t->regs = regs;
+		t->allocated = allocated;
+	}
+
+	memmove(t->regs + pos + nRegions, t->regs + pos, (t->nRegs - pos) * sizeof(XcolorRegion));
+	memcpy(t->regs + pos, region, nRegions * sizeof(XcolorRegion));
+	t->nRegs += nRegions;
+	t->changed = 1;
+
+	return 0;
+}
+
+int XcolorRegionTransactionDelete(XcolorRegionTransaction *t, unsigned long start, unsigned long count)
+{
+	if (t == NULL || start + count > t->nRegs)
+		return -1;
+
+	memmove(t->regs + start, t->regs + start + count, (t->nRegs - start - count) * sizeof(XcolorRegion));
+	t->nRegs -= count;
+	t->changed = 1;
+
+	return 0;
+}
+
+int XcolorRegionTransactionMove(XcolorRegionTransaction *t, unsigned long from, unsigned long count, unsigned long to)
+{
+	XcolorRegion *tmp;
+
+	if (t == NULL || from + count > t->nRegs || to + count > t->nRegs)
+		return -1;
+	if (from == to || count == 0)
+		return 0;
+
+	tmp = malloc(count * sizeof(XcolorRegion));
+	if (tmp == NULL)
+		return -1;
+
+	/* Take the regions out, close the gap and open it at the target. */
+	memcpy(tmp, t->regs + from, count * sizeof(XcolorRegion));
+	memmove(t->regs + from, t->regs + from + count, (t->nRegs - from - count) * sizeof(XcolorRegion));
+	memmove(t->regs + to + count, t->regs + to, (t->nRegs - count - to) * sizeof(XcolorRegion));
+	memcpy(t->regs + to, tmp, count * sizeof(XcolorRegion));
+	free(tmp);
+	t->changed = 1;
+
+	return 0;
+}
+
+XcolorRegion *XcolorRegionTransactionRegions(XcolorRegionTransaction *t, unsigned long *nRegions)
+{
+	if (t == NULL) {
+		if (nRegions)
+			*nRegions = 0;
+		return NULL;
+	}
+
+	if (nRegions)
+		*nRegions = t->nRegs;
+	return t->regs;
+}
+
+int XcolorRegionTransactionCommit(XcolorRegionTransaction *t, int activate)
+{
+	int result = 0;
+
+	if (t == NULL)
+		return -1;
+
+	if (t->changed) {
+		if (t->nRegs)
+			result = !XcmChangeProperty_(t->dpy, t->win, xcmAtom(t->dpy, XCM_ATOM_COLOR_REGIONS), PropModeReplace, (unsigned char *) t->regs, t->nRegs * sizeof(XcolorRegion));
+		else
+			result = !XDeleteProperty(t->dpy, t->win, xcmAtom(t->dpy, XCM_ATOM_COLOR_REGIONS));
+	}
+
+	if (activate && result == 0)
+		XcolorRegionActivate(t->dpy, t->win, 0, t->nRegs);
+
+	XcolorRegionTransactionAbort(t);
+
+	return result;
+}
+
+void XcolorRegionTransactionAbort(XcolorRegionTransaction *t)
+{
+	if (t == NULL)
+		return;
+
+	free(t->regs);
+	free(t);
+}
+
 static unsigned char * XcmFetchProperty(Display *dpy, Window w, Atom prop, Atom type, unsigned long *n, Bool del)
 {
   Atom actual;
@@ -208,7 +512,7 @@ int    XcmColorServerCapabilities    ( Display *dpy )
   int active = 0;
   unsigned long n = 0;
   unsigned char * data = 0;
-  Atom iccColorDesktop = XInternAtom(dpy, XCM_COLOR_DESKTOP, False);
+  Atom iccColorDesktop = xcmAtom(dpy, XCM_ATOM_COLOR_DESKTOP);
 
   data = XcmFetchProperty( dpy, RootWindow(dpy,0),
                            iccColorDesktop, XA_STRING, &n, False);
@@ -13,6 +13,10 @@
  *  @since    2010/12/28
  */
 
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE       /* struct ucred */
+#endif
+
 #include "XcmVersion.h"
 
 #if XCM_HAVE_LINUX
@@ -23,13 +27,23 @@
 #include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
+#include <strings.h>      /* strncasecmp() */
+#include <ctype.h>
 #include <unistd.h>       /* open(), write() */
 #include <dirent.h>       /* opendir() */
 #include <fcntl.h>        /* O_RDWR */
 /*#include <sys/stat.h>*/
 #include <unistd.h>       /* usleep() */
+#include <pthread.h>
+#include <time.h>         /* clock_gettime() */
+#include <errno.h>
 
 #include <sys/ioctl.h>
+#include <linux/i2c.h>
+#include <linux/i2c-dev.h>
+#include <sys/timerfd.h>
+#include <sys/socket.h>
+#include <linux/netlink.h>
 #include <linux/types.h>
 
 #ifndef USE_GETTEXT
@@ -44,7 +58,11 @@
 #define I2C_SLAVE_FORCE 0x0706
 #endif
 
-#define TIMEOUT 50000
+/* settle times of legacy transfers, adapted per device */
+#define XCM_DDC_DELAY_START 5000
+#define XCM_DDC_DELAY_MAX 200000
+/* a silent bus is empty only after the former fixed wait */
+#define XCM_DDC_DELAY_PROBE 50000
 
 #define I2C_DIR "/dev/"
 
@@ -57,183 +75,3429 @@
  *  properties. The former is supported by this library.
  *
  *  XcmDDClist() returns a list of monitor i2c device names.
+ *  XcmDDCConnectorList() prefers the connectors and EDIDs of sysfs.
+ *  XcmDDCHotplugOpen() reports connector changes from kernel uevents.
  *  XcmDDCgetEDID() can be used to fetch EEDID from a device name.
+ *  XcmDDCPoolGet() and XcmDDCDeviceOpen() give device handles, which keep
+ *  the device open for many transactions.
+ *  XcmDDCGetVCP(), XcmDDCSetVCP() and XcmDDCVCPBatch() access MCCS
+ *  features over DDC/CI. XcmDDCGetCapabilities() lists the supported ones.
+ *  XcmDDCEDIDCache() keeps EDIDs until a monitor change is detected.
+ *  All bus access goes through a XcmDDCTransport_s, by default the Linux
+ *  i2c-dev one; XcmDDCSetTransport() installs another, e.g. the mock of
+ *  XcmDDCTransportMockNew().
  *
  */
 
-/* basic access functions */
+/* Linux i2c-dev transport */
 
-/** Function XcmDDClist
- *  @brief   obtain all monitors i2c device names
- *
- *  @param[out]    list                empty pointer to a list of device names
- *  @param[out]    count               pass in a pointer to a int. gives the 
- *                                     number of elements in list
- *  @return                            error code
- *
- *  @version libXcm: 0.4.0
- *  @since   2010/12/28 (libXcm: 0.4.0)
- *  @date    2010/12/28
- */
-XCM_DDC_ERROR_e   XcmDDClist         ( char            *** list,
+static int         xcmDDCLinuxList   ( void              * user,
+                                       char            *** devices,
                                        int               * count )
 {
-  XCM_DDC_ERROR_e error = XCM_DDC_OK;
-
-  DIR * dir = opendir(I2C_DIR);
+  DIR * dir = opendir( I2C_DIR );
   struct dirent * entry;
-  char * data = 0;
-  size_t size;
-  char * fn = NULL;
-  int n = 0;
-  char ** devices = NULL;
+  char ** list = NULL;
+  int n = 0, size = 0;
 
+  (void)user;
+  *devices = NULL;
+  *count = 0;
   if(!dir)
-    return XCM_DDC_NO_FILE;
+    return -1;
 
-  fn = calloc(sizeof(char),1024);
-  if(!fn)
+  while((entry = readdir( dir )) != NULL)
   {
-    error = XCM_DDC_NO_FILE;
-    goto clean_list;
+    char name[sizeof(I2C_DIR) + 256];
+
+    if(strncmp( entry->d_name, "i2c-", 4 ) != 0)
+      continue;
+
+    if(n == size)
+    {
+      char ** l;
+      size = size ? size * 2 : 32;
+      l = realloc( list, size * sizeof(char*) );
+      if(!l)
+        break;
+      list = l;
+    }
+    snprintf( name, sizeof(name), I2C_DIR "%s", entry->d_name );
+    list[n] = strdup( name );
+    if(list[n])
+      ++n;
   }
+  closedir( dir );
+
+  *devices = list;
+  *count = n;
+  return 0;
+}
 
-  devices = calloc(sizeof(char*), 128);
-  if(!devices)
+static void *      xcmDDCLinuxOpen   ( void              * user,
+                                       const char        * device,
+                                       unsigned long     * funcs )
+{
+  unsigned long f = 0;
+  int * fd = malloc( sizeof(int) );
+
+  (void)user;
+  if(!fd)
+    return NULL;
+  *fd = open( device, O_RDWR | O_CLOEXEC );
+  if(*fd == -1)
   {
-    error = XCM_DDC_NO_FILE;
-    goto clean_list;
+    free( fd );
+    return NULL;
   }
 
-  do
+  *funcs = 0;
+  if(ioctl( *fd, I2C_FUNCS, &f ) == 0)
+  {
+    if(f & I2C_FUNC_I2C)
+      *funcs |= XCM_DDC_FUNC_I2C;
+    if(f & I2C_FUNC_SMBUS_READ_I2C_BLOCK)
+      *funcs |= XCM_DDC_FUNC_SMBUS_READ_BLOCK;
+  }
+
+  return fd;
+}
+
+static void        xcmDDCLinuxClose  ( void              * handle )
+{
+  int * fd = handle;
+  close( *fd );
+  free( fd );
+}
+
+static int         xcmDDCLinuxAddress( void              * handle,
+                                       int                 address,
+                                       int                 force )
+{
+  int * fd = handle;
+  return ioctl( *fd, force ? I2C_SLAVE_FORCE : I2C_SLAVE, address ) == 0 ?
+         0 : -1;
+}
+
+static int         xcmDDCLinuxTransfer(void              * handle,
+                                       XcmDDCMsg_s       * msgs,
+                                       int                 n )
+{
+  int * fd = handle;
+  struct i2c_msg m[8];
+  struct i2c_rdwr_ioctl_data rdwr;
+  int i;
+
+  if(n > 8)
+    return -1;
+  for(i = 0; i < n; ++i)
+  {
+    m[i].addr = msgs[i].addr;
+    m[i].flags = msgs[i].read ? I2C_M_RD : 0;
+    m[i].len = msgs[i].len;
+    m[i].buf = msgs[i].buf;
+  }
+  rdwr.msgs = m;
+  rdwr.nmsgs = n;
+
+  return ioctl( *fd, I2C_RDWR, &rdwr ) == n ? 0 : -1;
+}
+
+static int         xcmDDCLinuxSMBusRead (
+                                       void              * handle,
+                                       int                 command,
+                                       unsigned char     * buf,
+                                       int                 len )
+{
+  int * fd = handle;
+  union i2c_smbus_data data;
+  struct i2c_smbus_ioctl_data args;
+
+  if(len > I2C_SMBUS_BLOCK_MAX)
+    return -1;
+  data.block[0] = len;
+  args.read_write = I2C_SMBUS_READ;
+  args.command = command;
+  args.size = I2C_SMBUS_I2C_BLOCK_DATA;
+  args.data = &data;
+  if(ioctl( *fd, I2C_SMBUS, &args ) != 0 || data.block[0] != len)
+    return -1;
+  memcpy( buf, &data.block[1], len );
+
+  return 0;
+}
+
+static int         xcmDDCLinuxWrite  ( void              * handle,
+                                       const unsigned char * buf,
+                                       int                 len )
+{
+  int * fd = handle;
+  return write( *fd, buf, len );
+}
+
+static int         xcmDDCLinuxRead   ( void              * handle,
+                                       unsigned char     * buf,
+                                       int                 len )
+{
+  int * fd = handle;
+  return read( *fd, buf, len );
+}
+
+static const XcmDDCTransport_s xcm_ddc_linux = {
+  "linux-i2c-dev", NULL,
+  xcmDDCLinuxList,
+  xcmDDCLinuxOpen,
+  xcmDDCLinuxClose,
+  xcmDDCLinuxAddress,
+  xcmDDCLinuxTransfer,
+  xcmDDCLinuxSMBusRead,
+  xcmDDCLinuxWrite,
+  xcmDDCLinuxRead
+};
+
+/* the backend for newly opened devices */
+static const XcmDDCTransport_s * xcm_ddc_transport = &xcm_ddc_linux;
+static pthread_mutex_t xcm_ddc_transport_lock = PTHREAD_MUTEX_INITIALIZER;
+
+/** Function XcmDDCTransportLinux
+ *  @brief   the default Linux i2c-dev backend
+ *
+ *  @version libXcm: 0.5.5
+ *  @since   2026/10/17 (libXcm: 0.5.5)
+ *  @date    2026/10/17
+ */
+const XcmDDCTransport_s * XcmDDCTransportLinux ( void )
+{
+  return &xcm_ddc_linux;
+}
+
+/** Function XcmDDCSetTransport
+ *  @brief   select the bus backend
+ *
+ *  Devices opened afterwards and XcmDDClist() use the new backend.
+ *  Already opened devices keep theirs; call XcmDDCPoolClear() to drop
+ *  pooled ones. The transport must stay valid while devices use it.
+ *
+ *  @param[in]     transport           the backend; NULL for
+ *                                     XcmDDCTransportLinux()
+ *
+ *  @version libXcm: 0.5.5
+ *  @since   2026/10/17 (libXcm: 0.5.5)
+ *  @date    2026/10/17
+ */
+void              XcmDDCSetTransport ( const XcmDDCTransport_s * transport )
+{
+  pthread_mutex_lock( &xcm_ddc_transport_lock );
+  xcm_ddc_transport = transport ? transport : &xcm_ddc_linux;
+  pthread_mutex_unlock( &xcm_ddc_transport_lock );
+}
+
+static const XcmDDCTransport_s * xcmDDCTransportGet ( void )
+{
+  const XcmDDCTransport_s * transport;
+
+  pthread_mutex_lock( &xcm_ddc_transport_lock );
+  transport = xcm_ddc_transport;
+  pthread_mutex_unlock( &xcm_ddc_transport_lock );
+
+  return transport;
+}
+
+/* learned timing */
+
+typedef struct xcmDDCTiming_s_ {
+  char             * name;
+  long               delay_us;
+  int                learned;          /* in this process, file can't win */
+  struct xcmDDCTiming_s_ * next;
+} xcmDDCTiming_s;
+
+/* protects the timing table and its file */
+static pthread_mutex_t xcm_ddc_timing_lock = PTHREAD_MUTEX_INITIALIZER;
+static xcmDDCTiming_s * xcm_ddc_timing = NULL;
+static char * xcm_ddc_timing_file = NULL;
+static int xcm_ddc_timing_file_loaded = 0;
+
+/* @internal
+ * call with xcm_ddc_timing_lock held */
+static xcmDDCTiming_s * xcmDDCTimingFind ( const char    * device_name )
+{
+  xcmDDCTiming_s * t;
+  for(t = xcm_ddc_timing; t; t = t->next)
+    if(strcmp( t->name, device_name ) == 0)
+      return t;
+  return NULL;
+}
+
+/* @internal
+ * call with xcm_ddc_timing_lock held */
+static xcmDDCTiming_s * xcmDDCTimingSet ( const char      * device_name,
+                                       long                delay_us )
+{
+  xcmDDCTiming_s * t = xcmDDCTimingFind( device_name );
+
+  if(!t)
   {
-    entry = readdir( dir );
-    if(entry && strstr( entry->d_name, "i2c-" ))
+    t = calloc( 1, sizeof(xcmDDCTiming_s) );
+    if(!t)
+      return NULL;
+    t->name = strdup( device_name );
+    if(!t->name)
     {
-      sprintf( fn, I2C_DIR "%s", entry->d_name );
-      size = 0;
-      error = XcmDDCgetEDID( fn, &data, &size );
+      free( t );
+      return NULL;
+    }
+    t->next = xcm_ddc_timing;
+    xcm_ddc_timing = t;
+  }
+  t->delay_us = delay_us;
 
-      if(!error && (size % 128) == 0)
-      {
-        devices[n] = strdup(fn);
-        ++n;
-      }
+  return t;
+}
+
+/* @internal
+ * read lines of "device delay_us" from the timing file, the last wins;
+ * values learned in this process are kept;
+ * call with xcm_ddc_timing_lock held */
+static void        xcmDDCTimingRead  ( void )
+{
+  FILE * fp = fopen( xcm_ddc_timing_file, "r" );
+  char line[512];
+
+  while(fp && fgets( line, sizeof(line), fp ))
+  {
+    char name[256];
+    long delay_us;
+    xcmDDCTiming_s * t;
+
+    if(sscanf( line, "%255s %ld", name, &delay_us ) != 2 || delay_us <= 0)
+      continue;
+    t = xcmDDCTimingFind( name );
+    if(!t || !t->learned)
+      xcmDDCTimingSet( name, delay_us );
+  }
+  if(fp)
+    fclose( fp );
+}
+
+/* @internal
+ * read the timing file once;
+ * call with xcm_ddc_timing_lock held */
+static void        xcmDDCTimingLoad  ( void )
+{
+  if(xcm_ddc_timing_file_loaded || !xcm_ddc_timing_file)
+    return;
+  xcm_ddc_timing_file_loaded = 1;
+
+  xcmDDCTimingRead();
+}
 
-      if(data)
-        free(data);
-      data = 0;
+/* @internal
+ * rewrite the timing file with one line per device; entries of other
+ * processes are merged in first; the rename replaces the file atomically;
+ * call with xcm_ddc_timing_lock held */
+static void        xcmDDCTimingSave  ( void )
+{
+  xcmDDCTiming_s * t;
+  char * tmp;
+  FILE * fp;
+  int fd, error = 0;
+
+  xcmDDCTimingRead();
+
+  tmp = malloc( strlen( xcm_ddc_timing_file ) + 8 );
+  if(!tmp)
+    return;
+  sprintf( tmp, "%s.XXXXXX", xcm_ddc_timing_file );
+  fd = mkstemp( tmp );
+  fp = fd != -1 ? fdopen( fd, "w" ) : NULL;
+  if(!fp)
+  {
+    if(fd != -1)
+    {
+      close( fd );
+      unlink( tmp );
     }
-  } while(entry);
- 
+    free( tmp );
+    return;
+  }
 
-  *count = n;
+  for(t = xcm_ddc_timing; t; t = t->next)
+    if(fprintf( fp, "%s %ld\n", t->name, t->delay_us ) < 0)
+      error = 1;
+  if(fclose( fp ) != 0)
+    error = 1;
 
-  if(n > 0)
+  if(error || rename( tmp, xcm_ddc_timing_file ) != 0)
+    unlink( tmp );
+  free( tmp );
+}
+
+/* @internal
+ * the delay learned for a device, 0 if unknown */
+static long        xcmDDCTimingGet   ( const char        * device_name )
+{
+  xcmDDCTiming_s * t;
+  long delay_us = 0;
+
+  pthread_mutex_lock( &xcm_ddc_timing_lock );
+  xcmDDCTimingLoad();
+  t = xcmDDCTimingFind( device_name );
+  if(t)
+    delay_us = t->delay_us;
+  pthread_mutex_unlock( &xcm_ddc_timing_lock );
+
+  return delay_us;
+}
+
+static void        xcmDDCTimingStore ( const char        * device_name,
+                                       long                delay_us )
+{
+  xcmDDCTiming_s * t;
+
+  pthread_mutex_lock( &xcm_ddc_timing_lock );
+  xcmDDCTimingLoad();
+  t = xcmDDCTimingFind( device_name );
+  if(!t || t->delay_us != delay_us)
   {
-    *list = devices;
-    devices = NULL;
-  } else if(devices)
+    t = xcmDDCTimingSet( device_name, delay_us );
+    if(t)
+      t->learned = 1;
+    if(xcm_ddc_timing_file)
+      xcmDDCTimingSave();
+  }
+  pthread_mutex_unlock( &xcm_ddc_timing_lock );
+}
+
+/** Function XcmDDCTimingCache
+ *  @brief   set a file to keep learned bus delays across processes
+ *
+ *  @param[in]     file_name           the timing file; NULL disables it
+ *
+ *  @version libXcm: 0.5.5
+ *  @since   2026/10/17 (libXcm: 0.5.5)
+ *  @date    2026/10/17
+ */
+void              XcmDDCTimingCache  ( const char        * file_name )
+{
+  pthread_mutex_lock( &xcm_ddc_timing_lock );
+  free( xcm_ddc_timing_file );
+  xcm_ddc_timing_file = file_name ? strdup( file_name ) : NULL;
+  xcm_ddc_timing_file_loaded = 0;
+  pthread_mutex_unlock( &xcm_ddc_timing_lock );
+}
+
+
+/* device handles */
+
+struct XcmDDCDevice_s_ {
+  char             * name;
+  const XcmDDCTransport_s * transport;
+  void             * handle;           /* of the transport */
+  int                slave;            /* current i2c slave address or -1 */
+  int                refs;
+  int                pooled;
+  unsigned long      funcs;            /* XCM_DDC_FUNC_* of the adapter */
+  XCM_DDC_MODE_e     mode;             /* transfer mode, which worked */
+  long               read_us;          /* duration of the last EDID read */
+  long               delay_us;         /* smallest working legacy delay */
+  unsigned long      backoffs;         /* delay increases */
+  struct timespec    ci_ready;         /* earliest next DDC/CI message */
+  char             * connector;        /* sysfs DRM connector, "" for none */
+  char             * edid;             /* cached EDID or NULL */
+  size_t             edid_size;
+  int                edid_complete;    /* all blocks, not only the probe */
+  unsigned long      edid_generation;  /* user generation of the cache */
+  char               edid_stamp[64];   /* connector status and epoch */
+  pthread_mutex_t    lock;             /* serialises bus operations */
+  struct XcmDDCDevice_s_ * next;       /* pool list */
+};
+
+/* protects the pool list and all reference counts */
+static pthread_mutex_t xcm_ddc_pool_lock = PTHREAD_MUTEX_INITIALIZER;
+static XcmDDCDevice_s * xcm_ddc_pool = NULL;
+
+static XcmDDCDevice_s * xcmDDCDeviceNew ( const char      * device_name )
+{
+  XcmDDCDevice_s * dev = calloc( 1, sizeof(XcmDDCDevice_s) );
+
+  if(!dev)
+    return NULL;
+
+  dev->transport = xcmDDCTransportGet();
+  dev->handle = dev->transport->open( dev->transport->user, device_name,
+                                      &dev->funcs );
+  dev->name = strdup( device_name );
+  if(!dev->handle || !dev->name)
   {
-    free(devices);
-    devices = NULL;
+    if(dev->handle)
+      dev->transport->close( dev->handle );
+    free( dev->name );
+    free( dev );
+    return NULL;
   }
+  dev->slave = -1;
+  dev->refs = 1;
+  dev->delay_us = xcmDDCTimingGet( device_name );
+  pthread_mutex_init( &dev->lock, NULL );
 
-  clean_list:
-  if(devices)
-    free(devices);
-  if(dir)
-    closedir(dir);
-  if(fn)
-    free(fn);
+  return dev;
+}
 
-  return error;
+static void        xcmDDCDeviceFree  ( XcmDDCDevice_s    * dev )
+{
+  dev->transport->close( dev->handle );
+  pthread_mutex_destroy( &dev->lock );
+  free( dev->connector );
+  free( dev->edid );
+  free( dev->name );
+  free( dev );
+}
+
+/* @internal
+ * address a i2c slave, skipping the call when it is already selected;
+ * call with dev->lock held */
+static int         xcmDDCDeviceSlave ( XcmDDCDevice_s    * dev,
+                                       int                 address,
+                                       int                 force )
+{
+  if(dev->slave == address)
+    return 0;
+  if(dev->transport->address( dev->handle, address, force ) != 0)
+  {
+    dev->slave = -1;
+    return -1;
+  }
+  dev->slave = address;
+  return 0;
 }
 
+/** Function XcmDDCDeviceOpen
+ *  @brief   open a private device handle
+ *
+ *  The handle keeps the device open for many transactions, until it is
+ *  released. Use XcmDDCPoolGet() to share handles inside a process.
+ *
+ *  @param[in]     device_name         system specific device name
+ *  @param[out]    dev                 the new handle
+ *  @return                            error code
+ *
+ *  @version libXcm: 0.5.5
+ *  @since   2026/10/17 (libXcm: 0.5.5)
+ *  @date    2026/10/17
+ */
+XCM_DDC_ERROR_e   XcmDDCDeviceOpen   ( const char        * device_name,
+                                       XcmDDCDevice_s   ** dev )
+{
+  if(!device_name || !dev)
+    return XCM_DDC_NO_FILE;
+
+  *dev = xcmDDCDeviceNew( device_name );
 
-int fds[128];
-int fd_n = -1;
+  return *dev ? XCM_DDC_OK : XCM_DDC_NO_FILE;
+}
 
-/** Function XcmDDCgetEDID
- *  @brief   obtain all monitors i2c device names
+/* @internal
+ * a new reference to a pooled device or NULL */
+static XcmDDCDevice_s * xcmDDCPoolFind ( const char      * device_name )
+{
+  XcmDDCDevice_s * d;
+
+  pthread_mutex_lock( &xcm_ddc_pool_lock );
+  for(d = xcm_ddc_pool; d; d = d->next)
+    if(strcmp( d->name, device_name ) == 0)
+      break;
+  if(d)
+    ++d->refs;
+  pthread_mutex_unlock( &xcm_ddc_pool_lock );
+
+  return d;
+}
+
+/** Function XcmDDCPoolGet
+ *  @brief   get a shared device handle
+ *
+ *  The process wide pool keeps one open handle per device name. Repeated
+ *  queries of the same device skip the open() and slave setup. Release
+ *  the handle with XcmDDCDeviceRelease().
  *
  *  @param[in]     device_name         system specific device name
- *  @param[out]    data                empty pointer to EDID data, will be 
- *                                     mallocd for the user
- *  @param[out]    size                size of memory in data
+ *  @param[out]    dev                 the handle with a new reference
  *  @return                            error code
  *
- *  @version libXcm: 0.4.0
- *  @since   2010/12/28 (libXcm: 0.4,0)
- *  @date    2010/12/28
+ *  @version libXcm: 0.5.5
+ *  @since   2026/10/17 (libXcm: 0.5.5)
+ *  @date    2026/10/17
  */
-XCM_DDC_ERROR_e   XcmDDCgetEDID      ( const char        * device_name,
-                                       char             ** data,
-                                       size_t            * size )
+XCM_DDC_ERROR_e   XcmDDCPoolGet      ( const char        * device_name,
+                                       XcmDDCDevice_s   ** dev )
 {
-  int fd = 0,
-      ret = 0;
-  XCM_DDC_ERROR_e error = XCM_DDC_OK;
-  char command[128] = {0};
+  XcmDDCDevice_s * d, * n;
 
+  if(!device_name || !dev)
+    return XCM_DDC_NO_FILE;
+
+  *dev = xcmDDCPoolFind( device_name );
+  if(*dev)
+    return XCM_DDC_OK;
 
-  ++fd_n;
+  /* open() and the timing lookup can take long; other threads keep
+   * using the pool meanwhile */
+  n = xcmDDCDeviceNew( device_name );
+  if(!n)
+    return XCM_DDC_NO_FILE;
 
-  fds[fd_n] = open( device_name, O_RDWR );
-  fd = fds[fd_n];
+  pthread_mutex_lock( &xcm_ddc_pool_lock );
+  for(d = xcm_ddc_pool; d; d = d->next)
+    if(strcmp( d->name, device_name ) == 0)
+      break;
 
-  if(fd != -1)
+  if(d)
+    /* a other thread was faster */
+    ++d->refs;
+  else
   {
-    /* request the first 128 byte EDID block */
-    error = ioctl(fd, I2C_SLAVE, 0x50);
-    if(error == XCM_DDC_OK)
-    {
-      if(TIMEOUT)
-        usleep(TIMEOUT);
-      ret = write( fd, &command, 1 );
-    } else
-      error = XCM_DDC_PREPARE_FAIL;
+    /* one reference for the pool and one for the caller */
+    d = n;
+    d->refs = 2;
+    d->pooled = 1;
+    d->next = xcm_ddc_pool;
+    xcm_ddc_pool = d;
+    n = NULL;
+  }
+  pthread_mutex_unlock( &xcm_ddc_pool_lock );
 
-    if(ret == 1)
-    {
-      *data = (char*)calloc(sizeof(char),256);
-      if(TIMEOUT)
-        usleep(TIMEOUT);
-      ret = read( fd, *data, 128 );
-    } else
-      error = XCM_DDC_PREPARE_FAIL;
+  if(n)
+    xcmDDCDeviceFree( n );
 
-    if((ret % 128) == 0)
-    {
-      unsigned char * edid = (unsigned char*) *data;
+  *dev = d;
+  return XCM_DDC_OK;
+}
 
-      if(
-         edid[0] == 0 &&
-         edid[1] == 255 &&
-         edid[2] == 255 &&
-         edid[3] == 255 &&
-         edid[4] == 255 &&
-         edid[5] == 255 &&
-         edid[6] == 255 &&
-         edid[7] == 0)
-      {
-        *size = 128;
-      } else
-        error = XCM_DDC_WRONG_EDID;
-    }
+/** Function XcmDDCPoolClear
+ *  @brief   drop all pooled device handles
+ *
+ *  Devices are closed as soon as their last user released them.
+ *
+ *  @version libXcm: 0.5.5
+ *  @since   2026/10/17 (libXcm: 0.5.5)
+ *  @date    2026/10/17
+ */
+void              XcmDDCPoolClear    ( void )
+{
+  XcmDDCDevice_s * d, * next;
+
+  pthread_mutex_lock( &xcm_ddc_pool_lock );
+  for(d = xcm_ddc_pool; d; d = next)
+  {
+    next = d->next;
+    d->next = NULL;
+    d->pooled = 0;
+    if(--d->refs == 0)
+      xcmDDCDeviceFree( d );
+  }
+  xcm_ddc_pool = NULL;
+  pthread_mutex_unlock( &xcm_ddc_pool_lock );
+}
+
+/** Function XcmDDCDeviceRelease
+ *  @brief   release a device handle
+ *
+ *  @param[in,out] dev                 the handle; is set to NULL
+ *
+ *  @version libXcm: 0.5.5
+ *  @since   2026/10/17 (libXcm: 0.5.5)
+ *  @date    2026/10/17
+ */
+void              XcmDDCDeviceRelease( XcmDDCDevice_s   ** dev )
+{
+  int refs;
+
+  if(!dev || !*dev)
+    return;
+
+  pthread_mutex_lock( &xcm_ddc_pool_lock );
+  refs = --(*dev)->refs;
+  pthread_mutex_unlock( &xcm_ddc_pool_lock );
+
+  if(refs == 0)
+    xcmDDCDeviceFree( *dev );
+  *dev = NULL;
+}
+
+/** Function XcmDDCDeviceName
+ *  @brief   the device name of a handle
+ *
+ *  @version libXcm: 0.5.5
+ *  @since   2026/10/17 (libXcm: 0.5.5)
+ *  @date    2026/10/17
+ */
+const char *      XcmDDCDeviceName   ( const XcmDDCDevice_s * dev )
+{
+  return dev ? dev->name : NULL;
+}
+
+/** Function XcmDDCDeviceMode
+ *  @brief   the transfer mode, which the last EDID read used
+ *
+ *  @param[in]     dev                 the device handle
+ *  @param[out]    read_us             optional duration of the last
+ *                                     EDID read in microseconds
+ *  @return                            the mode or XCM_DDC_MODE_UNKNOWN
+ *
+ *  @version libXcm: 0.5.5
+ *  @since   2026/10/17 (libXcm: 0.5.5)
+ *  @date    2026/10/17
+ */
+XCM_DDC_MODE_e    XcmDDCDeviceMode   ( XcmDDCDevice_s    * dev,
+                                       long              * read_us )
+{
+  XCM_DDC_MODE_e mode;
 
-    if(error == XCM_DDC_OK)
+  if(!dev)
+    return XCM_DDC_MODE_UNKNOWN;
+
+  pthread_mutex_lock( &dev->lock );
+  mode = dev->mode;
+  if(read_us)
+    *read_us = dev->read_us;
+  pthread_mutex_unlock( &dev->lock );
+
+  return mode;
+}
+
+/** Function XcmDDCDeviceTiming
+ *  @brief   the learned settle time of legacy transfers
+ *
+ *  Legacy transfers start with a short delay between addressing, offset
+ *  write and read. The delay is doubled after a NAK or a wrong EDID
+ *  header. The smallest delay, which worked, is kept for the device name
+ *  in the process and in the optional file of XcmDDCTimingCache().
+ *
+ *  @param[in]     dev                 the device handle
+ *  @param[out]    delay_us            learned delay in microseconds,
+ *                                     0 if not yet known
+ *  @param[out]    backoffs            optional; number of delay increases
+ *
+ *  @version libXcm: 0.5.5
+ *  @since   2026/10/17 (libXcm: 0.5.5)
+ *  @date    2026/10/17
+ */
+void              XcmDDCDeviceTiming ( XcmDDCDevice_s    * dev,
+                                       long              * delay_us,
+                                       unsigned long     * backoffs )
+{
+  if(!dev)
+    return;
+
+  pthread_mutex_lock( &dev->lock );
+  if(delay_us)
+    *delay_us = dev->delay_us;
+  if(backoffs)
+    *backoffs = dev->backoffs;
+  pthread_mutex_unlock( &dev->lock );
+}
+
+/** Function XcmDDCModeToString
+ *  @brief   name of a transfer mode
+ *
+ *  @version libXcm: 0.5.5
+ *  @since   2026/10/17 (libXcm: 0.5.5)
+ *  @date    2026/10/17
+ */
+const char *      XcmDDCModeToString ( XCM_DDC_MODE_e      mode )
+{
+  const char * text = "unknown";
+  switch(mode)
+  {
+  case XCM_DDC_MODE_UNKNOWN: break;
+  case XCM_DDC_MODE_I2C_RDWR: text = "i2c_rdwr"; break;
+  case XCM_DDC_MODE_SMBUS: text = "smbus"; break;
+  case XCM_DDC_MODE_LEGACY: text = "legacy"; break;
+  }
+  return text;
+}
+
+/* @internal
+ * put a private device into the pool, unless the name is already there */
+static void        xcmDDCPoolAdopt   ( XcmDDCDevice_s    * dev )
+{
+  XcmDDCDevice_s * d;
+
+  pthread_mutex_lock( &xcm_ddc_pool_lock );
+  for(d = xcm_ddc_pool; d; d = d->next)
+    if(strcmp( d->name, dev->name ) == 0)
+      break;
+  if(!d && !dev->pooled)
+  {
+    ++dev->refs;
+    dev->pooled = 1;
+    dev->next = xcm_ddc_pool;
+    xcm_ddc_pool = dev;
+  }
+  pthread_mutex_unlock( &xcm_ddc_pool_lock );
+}
+
+/* @internal
+ * take a device out of the pool; other users keep their references */
+static void        xcmDDCPoolDrop    ( XcmDDCDevice_s    * dev )
+{
+  XcmDDCDevice_s ** d;
+  int refs = 1;
+
+  if(!dev)
+    return;
+
+  pthread_mutex_lock( &xcm_ddc_pool_lock );
+  for(d = &xcm_ddc_pool; *d; d = &(*d)->next)
+    if(*d == dev)
     {
-      if(TIMEOUT)
-        usleep(TIMEOUT);
-      error = ioctl(fd, I2C_SLAVE_FORCE, 0x37);
-      if(error != XCM_DDC_OK)
-        error = XCM_DDC_PREPARE_FAIL;
+      *d = dev->next;
+      dev->next = NULL;
+      dev->pooled = 0;
+      refs = --dev->refs;
+      break;
     }
-  } else
-    error = XCM_DDC_NO_FILE;
+  pthread_mutex_unlock( &xcm_ddc_pool_lock );
 
-  return error;
+  if(refs == 0)
+    xcmDDCDeviceFree( dev );
+}
+
+/* EDID cache */
+
+/* FNV-1a */
+static uint64_t    xcmDDCHash        ( const unsigned char * data,
+                                       size_t              size )
+{
+  uint64_t h = 14695981039346656037ULL;
+  size_t i;
+  for(i = 0; i < size; ++i)
+    h = (h ^ data[i]) * 1099511628211ULL;
+  return h;
+}
+
+#ifndef XCM_DDC_SYSFS_DRM               /* tests point it to a fixture */
+#define XCM_DDC_SYSFS_DRM "/sys/class/drm/"
+#endif
+
+/* protects the EDID cache settings and counters */
+static pthread_mutex_t xcm_ddc_cache_lock = PTHREAD_MUTEX_INITIALIZER;
+static int xcm_ddc_cache_enabled = 0;
+static unsigned long xcm_ddc_cache_generation = 0;
+static unsigned long xcm_ddc_cache_hits = 0;
+static unsigned long xcm_ddc_cache_misses = 0;
+
+/* @internal
+ * connector directory names look like card0-DP-1 */
+static int         xcmDDCSysfsIsConnector (
+                                       const char        * name )
+{
+  return strncmp( name, "card", 4 ) == 0 && strchr( name, '-' ) != NULL;
+}
+
+/* @internal
+ * the i2c bus name, e.g. i2c-7, of a connector directory or NULL */
+static char *      xcmDDCSysfsBus    ( const char        * connector )
+{
+  char path[sizeof(XCM_DDC_SYSFS_DRM) + 2*256 + 8], link[512];
+  const char * bus;
+  ssize_t len;
+  DIR * dir;
+  struct dirent * entry;
+  char * found = NULL;
+
+  snprintf( path, sizeof(path), "%s/ddc", connector );
+  len = readlink( path, link, sizeof(link) - 1 );
+  if(len > 0)
+  {
+    link[len] = '\000';
+    bus = strrchr( link, '/' );
+    bus = bus ? bus + 1 : link;
+    if(strncmp( bus, "i2c-", 4 ) == 0)
+      return strdup( bus );
+  }
+
+  /* some drivers place the adapter below the connector */
+  dir = opendir( connector );
+  while(dir && !found && (entry = readdir( dir )) != NULL)
+    if(strncmp( entry->d_name, "i2c-", 4 ) == 0)
+      found = strdup( entry->d_name );
+  if(dir)
+    closedir( dir );
+
+  return found;
+}
+
+/* @internal
+ * find the DRM connector, which drives the i2c bus of device_name */
+static char *      xcmDDCSysfsConnector (
+                                       const char        * device_name )
+{
+  const char * bus = strrchr( device_name, '/' );
+  DIR * dir;
+  struct dirent * entry;
+  char * connector = NULL;
+
+  bus = bus ? bus + 1 : device_name;
+  dir = opendir( XCM_DDC_SYSFS_DRM );
+  if(!dir)
+    return NULL;
+
+  while(!connector && (entry = readdir( dir )) != NULL)
+  {
+    char path[sizeof(XCM_DDC_SYSFS_DRM) + 256];
+    char * b;
+
+    if(!xcmDDCSysfsIsConnector( entry->d_name ))
+      continue;
+
+    snprintf( path, sizeof(path), XCM_DDC_SYSFS_DRM "%s", entry->d_name );
+    b = xcmDDCSysfsBus( path );
+    if(b && strcmp( b, bus ) == 0)
+      connector = strdup( path );
+    free( b );
+  }
+  closedir( dir );
+
+  return connector;
+}
+
+/* @internal
+ * read a small sysfs attribute of a connector */
+static int         xcmDDCSysfsRead   ( const char        * connector,
+                                       const char        * attribute,
+                                       char              * text,
+                                       int                 size )
+{
+  char path[sizeof(XCM_DDC_SYSFS_DRM) + 2*256 + 8];
+  int fd, len;
+
+  snprintf( path, sizeof(path), "%s/%s", connector, attribute );
+  fd = open( path, O_RDONLY | O_CLOEXEC );
+  if(fd == -1)
+    return -1;
+  len = read( fd, text, size - 1 );
+  close( fd );
+  if(len < 0)
+    return -1;
+  while(len && (text[len-1] == '\n' || text[len-1] == ' '))
+    --len;
+  text[len] = '\000';
+
+  return len;
+}
+
+/* @internal
+ * state of the attached connector: status and hotplug epoch;
+ * empty without a sysfs connector */
+static void        xcmDDCCacheStamp  ( XcmDDCDevice_s    * dev,
+                                       char              * stamp,
+                                       int                 size )
+{
+  int len;
+
+  stamp[0] = '\000';
+
+  pthread_mutex_lock( &dev->lock );
+  if(!dev->connector)
+  {
+    dev->connector = xcmDDCSysfsConnector( dev->name );
+    if(!dev->connector)
+      dev->connector = strdup( "" );
+  }
+  pthread_mutex_unlock( &dev->lock );
+
+  if(!dev->connector || !dev->connector[0])
+    return;
+
+  len = xcmDDCSysfsRead( dev->connector, "status", stamp, size );
+  if(len < 0 || len + 2 >= size)
+    return;
+  stamp[len++] = ':';
+  /* epoch counts hotplug events since kernel 5.7 */
+  if(xcmDDCSysfsRead( dev->connector, "epoch", stamp + len, size - len ) < 0)
+    stamp[len] = '\000';
+}
+
+/* @internal
+ * answer from the cached EDID, if it is still valid;
+ * stamp receives the connector state for a later xcmDDCCacheStore() */
+static int         xcmDDCCacheLookup ( XcmDDCDevice_s    * dev,
+                                       int                 blocks_max,
+                                       char              * stamp,
+                                       int                 stamp_size,
+                                       char             ** data,
+                                       size_t            * size )
+{
+  unsigned long generation;
+  int enabled, hit = 0;
+
+  pthread_mutex_lock( &xcm_ddc_cache_lock );
+  enabled = xcm_ddc_cache_enabled;
+  generation = xcm_ddc_cache_generation;
+  pthread_mutex_unlock( &xcm_ddc_cache_lock );
+
+  if(!enabled)
+    return 0;
+
+  xcmDDCCacheStamp( dev, stamp, stamp_size );
+
+  pthread_mutex_lock( &dev->lock );
+  if(dev->edid &&
+     dev->edid_generation == generation &&
+     strcmp( dev->edid_stamp, stamp ) == 0 &&
+     (dev->edid_complete ||
+      (blocks_max && (size_t)blocks_max * 128 <= dev->edid_size)))
+  {
+    size_t n = dev->edid_size;
+    if(blocks_max && (size_t)blocks_max * 128 < n)
+      n = blocks_max * 128;
+    *data = malloc( n );
+    if(*data)
+    {
+      memcpy( *data, dev->edid, n );
+      *size = n;
+      hit = 1;
+    }
+  }
+  pthread_mutex_unlock( &dev->lock );
+
+  pthread_mutex_lock( &xcm_ddc_cache_lock );
+  if(hit)
+    ++xcm_ddc_cache_hits;
+  else
+    ++xcm_ddc_cache_misses;
+  pthread_mutex_unlock( &xcm_ddc_cache_lock );
+
+  return hit;
+}
+
+static void        xcmDDCCacheStore  ( XcmDDCDevice_s    * dev,
+                                       int                 blocks_max,
+                                       const char        * stamp,
+                                       const char        * data,
+                                       size_t              size )
+{
+  unsigned long generation;
+  int enabled;
+  char * edid;
+
+  pthread_mutex_lock( &xcm_ddc_cache_lock );
+  enabled = xcm_ddc_cache_enabled;
+  generation = xcm_ddc_cache_generation;
+  pthread_mutex_unlock( &xcm_ddc_cache_lock );
+
+  if(!enabled || !size)
+    return;
+
+  pthread_mutex_lock( &dev->lock );
+  /* keep a complete EDID over a shorter one */
+  if(!(dev->edid && dev->edid_complete && blocks_max &&
+       dev->edid_generation == generation &&
+       strcmp( dev->edid_stamp, stamp ) == 0))
+  {
+    edid = malloc( size );
+    if(edid)
+    {
+      memcpy( edid, data, size );
+      free( dev->edid );
+      dev->edid = edid;
+      dev->edid_size = size;
+      dev->edid_complete = blocks_max == 0;
+      dev->edid_generation = generation;
+      snprintf( dev->edid_stamp, sizeof(dev->edid_stamp), "%s", stamp );
+    }
+  }
+  pthread_mutex_unlock( &dev->lock );
+}
+
+/** Function XcmDDCEDIDCache
+ *  @brief   switch the EDID cache of device handles on or off
+ *
+ *  With the cache, XcmDDCgetEDID(), XcmDDCDeviceGetEDID() and XcmDDClist()
+ *  answer from the EDID last read from a device, as long as its DRM
+ *  connector reports the same status and hotplug epoch in sysfs and the
+ *  generation of XcmDDCEDIDCacheGeneration() did not change. Buses without
+ *  a sysfs connector rely on the generation alone. Buses without a monitor
+ *  are still probed.
+ *
+ *  @param[in]     enable              1 to enable, 0 to disable the cache
+ *
+ *  @version libXcm: 0.5.5
+ *  @since   2026/10/17 (libXcm: 0.5.5)
+ *  @date    2026/10/17
+ */
+void              XcmDDCEDIDCache    ( int                 enable )
+{
+  pthread_mutex_lock( &xcm_ddc_cache_lock );
+  xcm_ddc_cache_enabled = enable ? 1 : 0;
+  pthread_mutex_unlock( &xcm_ddc_cache_lock );
+}
+
+/** Function XcmDDCEDIDCacheGeneration
+ *  @brief   invalidate cached EDIDs by a user counter
+ *
+ *  Pass a new value, e.g. after a RandR or hotplug notification. Cached
+ *  EDIDs of other generations are read again from the bus.
+ *
+ *  @param[in]     generation          the current user generation
+ *
+ *  @version libXcm: 0.5.5
+ *  @since   2026/10/17 (libXcm: 0.5.5)
+ *  @date    2026/10/17
+ */
+void              XcmDDCEDIDCacheGeneration (
+                                       unsigned long       generation )
+{
+  pthread_mutex_lock( &xcm_ddc_cache_lock );
+  xcm_ddc_cache_generation = generation;
+  pthread_mutex_unlock( &xcm_ddc_cache_lock );
+}
+
+/** Function XcmDDCEDIDCacheStats
+ *  @brief   EDID cache counters
+ *
+ *  In steady state only hits should increase.
+ *
+ *  @param[out]    hits                optional; EDIDs answered from cache
+ *  @param[out]    misses              optional; EDIDs read from the bus
+ *
+ *  @version libXcm: 0.5.5
+ *  @since   2026/10/17 (libXcm: 0.5.5)
+ *  @date    2026/10/17
+ */
+void              XcmDDCEDIDCacheStats (
+                                       unsigned long     * hits,
+                                       unsigned long     * misses )
+{
+  pthread_mutex_lock( &xcm_ddc_cache_lock );
+  if(hits)
+    *hits = xcm_ddc_cache_hits;
+  if(misses)
+    *misses = xcm_ddc_cache_misses;
+  pthread_mutex_unlock( &xcm_ddc_cache_lock );
+}
+
+
+/* basic access functions */
+
+#define XCM_DDC_LIST_MAX_THREADS 16
+#define XCM_DDC_LIST_TIMEOUT 5000
+
+typedef struct {
+  char             * name;
+  int                bus;              /* number of a i2c-N name or -1 */
+  int                found;
+  XCM_DDC_ERROR_e    error;
+} xcmDDCBus_s;
+
+typedef struct {
+  xcmDDCBus_s      * buses;
+  int                n;
+  int                next;
+  struct timespec    deadline;
+  pthread_mutex_t    lock;
+} xcmDDCProbe_s;
+
+static XCM_DDC_ERROR_e xcmDDCgetEDID ( XcmDDCDevice_s    * dev,
+                                       int                 blocks_max,
+                                       const struct timespec * deadline,
+                                       char             ** data,
+                                       size_t            * size );
+
+static int         xcmDDCBusCompare  ( const void        * a,
+                                       const void        * b )
+{
+  const xcmDDCBus_s * ba = a, * bb = b;
+  if(ba->bus != bb->bus)
+    return (ba->bus > bb->bus) - (ba->bus < bb->bus);
+  return strcmp( ba->name, bb->name );
+}
+
+static int         xcmDDCExpired     ( const struct timespec * deadline )
+{
+  struct timespec now;
+  clock_gettime( CLOCK_MONOTONIC, &now );
+  return now.tv_sec > deadline->tv_sec ||
+         (now.tv_sec == deadline->tv_sec && now.tv_nsec >= deadline->tv_nsec);
+}
+
+/* @internal
+ * worker: take the next bus until all are done or the deadline passed;
+ * a running read ends at the deadline too */
+static void *      xcmDDCProbeRun    ( void              * arg )
+{
+  xcmDDCProbe_s * probe = arg;
+
+  for(;;)
+  {
+    xcmDDCBus_s * bus;
+    char * data = NULL;
+    size_t size = 0;
+    XcmDDCDevice_s * dev = NULL;
+
+    pthread_mutex_lock( &probe->lock );
+    if(probe->next < probe->n && !xcmDDCExpired( &probe->deadline ))
+      bus = &probe->buses[probe->next++];
+    else
+      bus = NULL;
+    pthread_mutex_unlock( &probe->lock );
+    if(!bus)
+      break;
+
+    /* most buses have no monitor; keep only monitors in the pool */
+    dev = xcmDDCPoolFind( bus->name );
+    if(dev)
+      /* known monitor, which may answer from the EDID cache */
+      bus->error = XCM_DDC_OK;
+    else
+      bus->error = XcmDDCDeviceOpen( bus->name, &dev );
+    if(bus->error == XCM_DDC_OK)
+      /* the first block is enough to detect a monitor */
+      bus->error = xcmDDCgetEDID( dev, 1, &probe->deadline, &data, &size );
+
+    bus->found = !bus->error && size && (size % 128) == 0;
+    if(bus->found)
+      /* keep the descriptor and the learned transfer mode */
+      xcmDDCPoolAdopt( dev );
+    XcmDDCDeviceRelease( &dev );
+    free( data );
+  }
+
+  return NULL;
+}
+
+/** Function XcmDDClistParallel
+ *  @brief   obtain all monitors i2c device names by probing buses in parallel
+ *
+ *  Each i2c bus is probed for a EDID with a small pool of threads. The
+ *  scan takes about as long as the slowest bus, but not longer than the
+ *  deadline plus one bus transfer. Buses, which are not finished by then,
+ *  are skipped as timed out. If no monitor was found, the first error in
+ *  bus order is returned, XCM_DDC_TIMEOUT for a bus cut by the deadline.
+ *
+ *  @param[out]    list                empty pointer to a list of device names
+ *                                     sorted by bus number
+ *  @param[out]    count               pass in a pointer to a int. gives the 
+ *                                     number of elements in list
+ *  @param[in]     threads             maximum number of parallel probes;
+ *                                     0 means one per bus up to 16
+ *  @param[in]     timeout_ms          overall deadline in milliseconds;
+ *                                     0 means 5 seconds
+ *  @return                            error code
+ *
+ *  @version libXcm: 0.5.5
+ *  @since   2026/10/17 (libXcm: 0.5.5)
+ *  @date    2026/10/17
+ */
+XCM_DDC_ERROR_e   XcmDDClistParallel ( char            *** list,
+                                       int               * count,
+                                       int                 threads,
+                                       int                 timeout_ms )
+{
+  XCM_DDC_ERROR_e error = XCM_DDC_OK;
+  const XcmDDCTransport_s * transport = xcmDDCTransportGet();
+  xcmDDCProbe_s probe;
+  pthread_t tids[XCM_DDC_LIST_MAX_THREADS];
+  int started[XCM_DDC_LIST_MAX_THREADS];
+  int i, n = 0;
+  char ** devices = NULL, ** names = NULL;
+
+  if(!list || !count)
+    return XCM_DDC_NO_FILE;
+  *count = 0;
+
+  memset( &probe, 0, sizeof(probe) );
+
+  if(transport->list( transport->user, &names, &probe.n ) != 0)
+    return XCM_DDC_NO_FILE;
+
+  if(probe.n)
+  {
+    probe.buses = calloc( probe.n, sizeof(xcmDDCBus_s) );
+    if(!probe.buses)
+    {
+      error = XCM_DDC_NO_FILE;
+      goto clean_list;
+    }
+  }
+  for(i = 0; i < probe.n; ++i)
+  {
+    const char * bus = strstr( names[i], "i2c-" );
+    probe.buses[i].name = names[i];
+    probe.buses[i].bus = bus ? atoi( bus + 4 ) : -1;
+  }
+
+  if(!probe.n)
+    goto clean_list;
+
+  /* stable order independent of the backend */
+  qsort( probe.buses, probe.n, sizeof(xcmDDCBus_s), xcmDDCBusCompare );
+
+  if(timeout_ms <= 0)
+    timeout_ms = XCM_DDC_LIST_TIMEOUT;
+  clock_gettime( CLOCK_MONOTONIC, &probe.deadline );
+  probe.deadline.tv_sec += timeout_ms / 1000;
+  probe.deadline.tv_nsec += (long)(timeout_ms % 1000) * 1000000;
+  if(probe.deadline.tv_nsec >= 1000000000)
+  {
+    ++probe.deadline.tv_sec;
+    probe.deadline.tv_nsec -= 1000000000;
+  }
+  pthread_mutex_init( &probe.lock, NULL );
+
+  if(threads <= 0 || threads > XCM_DDC_LIST_MAX_THREADS)
+    threads = XCM_DDC_LIST_MAX_THREADS;
+  if(threads > probe.n)
+    threads = probe.n;
+
+  for(i = 1; i < threads; ++i)
+    started[i] = pthread_create( &tids[i], NULL, xcmDDCProbeRun, &probe ) == 0;
+  xcmDDCProbeRun( &probe );
+  for(i = 1; i < threads; ++i)
+    if(started[i])
+      pthread_join( tids[i], NULL );
+
+  pthread_mutex_destroy( &probe.lock );
+
+  /* buses, which were not started before the deadline */
+  for(i = probe.next; i < probe.n; ++i)
+    probe.buses[i].error = XCM_DDC_TIMEOUT;
+
+  for(i = 0; i < probe.n; ++i)
+    if(probe.buses[i].found)
+      ++n;
+
+  if(n > 0)
+  {
+    devices = calloc( sizeof(char*), n );
+    if(!devices)
+    {
+      error = XCM_DDC_NO_FILE;
+      goto clean_list;
+    }
+    for(i = 0, n = 0; i < probe.n; ++i)
+      if(probe.buses[i].found)
+        devices[n++] = strdup( probe.buses[i].name );
+    *list = devices;
+    *count = n;
+  } else
+  {
+    /* report the first failure in bus order */
+    for(i = 0; i < probe.n; ++i)
+      if(probe.buses[i].error)
+      {
+        error = probe.buses[i].error;
+        break;
+      }
+  }
+
+  clean_list:
+  for(i = 0; i < probe.n; ++i)
+    free( names[i] );
+  free( names );
+  free( probe.buses );
+
+  return error;
+}
+
+/** Function XcmDDClist
+ *  @brief   obtain all monitors i2c device names
+ *
+ *  The buses are probed in parallel, see XcmDDClistParallel().
+ *
+ *  @param[out]    list                empty pointer to a list of device names
+ *  @param[out]    count               pass in a pointer to a int. gives the 
+ *                                     number of elements in list
+ *  @return                            error code
+ *
+ *  @version libXcm: 0.5.5
+ *  @since   2010/12/28 (libXcm: 0.4.0)
+ *  @date    2026/10/17
+ */
+XCM_DDC_ERROR_e   XcmDDClist         ( char            *** list,
+                                       int               * count )
+{
+  return XcmDDClistParallel( list, count, 0, 0 );
+}
+
+/* DRM connector discovery */
+
+/* @internal
+ * read a binary sysfs file completely */
+static int         xcmDDCSysfsReadAll( const char        * path,
+                                       char             ** data,
+                                       size_t            * size )
+{
+  int fd = open( path, O_RDONLY | O_CLOEXEC );
+  char * buf = NULL;
+  size_t n = 0, allocated = 0;
+  ssize_t len;
+
+  *data = NULL;
+  *size = 0;
+  if(fd == -1)
+    return -1;
+
+  do
+  {
+    if(n == allocated)
+    {
+      char * b;
+      allocated = allocated ? allocated * 2 : 512;
+      b = realloc( buf, allocated );
+      if(!b)
+      {
+        len = -1;
+        break;
+      }
+      buf = b;
+    }
+    len = read( fd, buf + n, allocated - n );
+    if(len > 0)
+      n += len;
+  } while(len > 0);
+  close( fd );
+
+  if(len < 0 || n == 0)
+  {
+    free( buf );
+    return len < 0 ? -1 : 0;
+  }
+  *data = buf;
+  *size = n;
+  return 0;
+}
+
+static int         xcmDDCConnectorCompare (
+                                       const void        * a,
+                                       const void        * b )
+{
+  const XcmDDCConnector_s * ca = a, * cb = b;
+  return strcmp( ca->name, cb->name );
+}
+
+/* @internal
+ * list connectors from sysfs; the EDID comes from the kernel cache */
+static int         xcmDDCConnectorsSysfs (
+                                       XcmDDCConnector_s ** list,
+                                       int               * count )
+{
+  DIR * dir = opendir( XCM_DDC_SYSFS_DRM );
+  struct dirent * entry;
+  XcmDDCConnector_s * connectors = NULL;
+  int n = 0, size = 0;
+
+  *list = NULL;
+  *count = 0;
+  if(!dir)
+    return -1;
+
+  while((entry = readdir( dir )) != NULL)
+  {
+    char path[sizeof(XCM_DDC_SYSFS_DRM) + 2*256 + 8], status[32];
+    XcmDDCConnector_s * c;
+    char * bus;
+
+    if(!xcmDDCSysfsIsConnector( entry->d_name ))
+      continue;
+
+    if(n == size)
+    {
+      XcmDDCConnector_s * l;
+      size = size ? size * 2 : 8;
+      l = realloc( connectors, size * sizeof(XcmDDCConnector_s) );
+      if(!l)
+        break;
+      connectors = l;
+    }
+    c = &connectors[n];
+    memset( c, 0, sizeof(XcmDDCConnector_s) );
+
+    snprintf( path, sizeof(path), XCM_DDC_SYSFS_DRM "%s", entry->d_name );
+    if(xcmDDCSysfsRead( path, "status", status, sizeof(status) ) < 0)
+      continue;
+    c->name = strdup( entry->d_name );
+    c->status = strdup( status );
+    bus = xcmDDCSysfsBus( path );
+    if(bus)
+    {
+      c->device = malloc( sizeof(I2C_DIR) + strlen( bus ) );
+      if(c->device)
+        sprintf( c->device, I2C_DIR "%s", bus );
+      free( bus );
+    }
+    if(strcmp( status, "connected" ) == 0)
+    {
+      snprintf( path, sizeof(path), XCM_DDC_SYSFS_DRM "%s/edid",
+                entry->d_name );
+      xcmDDCSysfsReadAll( path, &c->edid, &c->edid_size );
+      c->sysfs = c->edid != NULL;
+    }
+    ++n;
+  }
+  closedir( dir );
+
+  if(n)
+    qsort( connectors, n, sizeof(XcmDDCConnector_s), xcmDDCConnectorCompare );
+
+  *list = connectors;
+  *count = n;
+  return 0;
+}
+
+/** Function XcmDDCConnectorList
+ *  @brief   list monitor connectors with their EDID
+ *
+ *  On KMS systems the connectors and the EDID, which the kernel cached,
+ *  are read from sysfs in microseconds. A connected connector without a
+ *  cached EDID is read over its i2c bus. Only if sysfs lists no
+ *  connectors, all buses are probed with XcmDDClist().
+ *
+ *  @param[out]    list                the connectors, release with
+ *                                     XcmDDCConnectorListRelease()
+ *  @param[out]    count               number of connectors in list
+ *  @return                            error code
+ *
+ *  @version libXcm: 0.5.5
+ *  @since   2026/10/17 (libXcm: 0.5.5)
+ *  @date    2026/10/17
+ */
+XCM_DDC_ERROR_e   XcmDDCConnectorList( XcmDDCConnector_s ** list,
+                                       int               * count )
+{
+  XCM_DDC_ERROR_e error = XCM_DDC_OK;
+  XcmDDCConnector_s * connectors = NULL;
+  int i, n = 0;
+
+  if(!list || !count)
+    return XCM_DDC_NO_FILE;
+
+  xcmDDCConnectorsSysfs( &connectors, &n );
+
+  if(n)
+  {
+    for(i = 0; i < n; ++i)
+    {
+      XcmDDCConnector_s * c = &connectors[i];
+      if(!c->edid && c->device && c->status &&
+         strcmp( c->status, "connected" ) == 0)
+        XcmDDCgetEDID( c->device, &c->edid, &c->edid_size );
+    }
+  } else
+  {
+    char ** devices = NULL;
+
+    free( connectors );
+    connectors = NULL;
+    error = XcmDDClist( &devices, &n );
+    if(n)
+    {
+      connectors = calloc( n, sizeof(XcmDDCConnector_s) );
+      if(!connectors)
+        error = XCM_DDC_NO_FILE;
+    }
+    for(i = 0; i < n; ++i)
+    {
+      if(connectors)
+      {
+        XcmDDCConnector_s * c = &connectors[i];
+        const char * name = strrchr( devices[i], '/' );
+        c->name = strdup( name ? name + 1 : devices[i] );
+        c->status = strdup( "connected" );
+        c->device = devices[i];
+        XcmDDCgetEDID( c->device, &c->edid, &c->edid_size );
+      } else
+        free( devices[i] );
+    }
+    free( devices );
+    if(!connectors)
+      n = 0;
+  }
+
+  *list = connectors;
+  *count = n;
+  return error;
+}
+
+/** Function XcmDDCConnectorListRelease
+ *  @brief   release a list of XcmDDCConnectorList()
+ *
+ *  @param[in,out] list                the connectors; is set to NULL
+ *  @param[in]     count               number of connectors in list
+ *
+ *  @version libXcm: 0.5.5
+ *  @since   2026/10/17 (libXcm: 0.5.5)
+ *  @date    2026/10/17
+ */
+void              XcmDDCConnectorListRelease (
+                                       XcmDDCConnector_s ** list,
+                                       int                 count )
+{
+  int i;
+
+  if(!list || !*list)
+    return;
+
+  for(i = 0; i < count; ++i)
+  {
+    free( (*list)[i].name );
+    free( (*list)[i].status );
+    free( (*list)[i].device );
+    free( (*list)[i].edid );
+  }
+  free( *list );
+  *list = NULL;
+}
+
+
+typedef enum {
+  XCM_DDC_STATE_BLOCK,                 /* combined read of one block */
+  XCM_DDC_STATE_SMBUS,                 /* SMBus block reads of one block */
+  XCM_DDC_STATE_SLAVE,                 /* address the EDID slave */
+  XCM_DDC_STATE_WRITE,                 /* send the EDID offset */
+  XCM_DDC_STATE_READ,                  /* read one block */
+  XCM_DDC_STATE_DDCCI,                 /* switch to the DDC/CI slave */
+  XCM_DDC_STATE_DONE
+} xcmDDCState_e;
+
+struct XcmDDCTransaction_s_ {
+  XcmDDCDevice_s   * dev;              /* holds a reference */
+  int                timer_fd;         /* -1 for blocking use */
+  xcmDDCState_e      state;
+  XCM_DDC_MODE_e     mode;             /* transfer mode in use */
+  long               delay_us;         /* legacy settle time */
+  struct timespec    start;
+  int                block;            /* next block to read */
+  int                blocks;           /* announced blocks */
+  int                blocks_max;       /* 0 for all */
+  struct timespec    due;              /* earliest time of the next step */
+  const struct timespec * deadline;    /* optional end of the transaction */
+  XCM_DDC_ERROR_e    error;
+  char             * data;
+  size_t             size;
+};
+
+/* @internal
+ * preferred transfer mode: the one, which worked before, or the best the
+ * adapter announces */
+static XCM_DDC_MODE_e xcmDDCModeFirst( XcmDDCDevice_s    * dev )
+{
+  if(dev->mode != XCM_DDC_MODE_UNKNOWN)
+    return dev->mode;
+  if(!dev->funcs || dev->funcs & XCM_DDC_FUNC_I2C)
+    return XCM_DDC_MODE_I2C_RDWR;
+  if(dev->funcs & XCM_DDC_FUNC_SMBUS_READ_BLOCK)
+    return XCM_DDC_MODE_SMBUS;
+  return XCM_DDC_MODE_LEGACY;
+}
+
+/* @internal
+ * fallback after a rejected transfer */
+static XCM_DDC_MODE_e xcmDDCModeNext ( XcmDDCDevice_s    * dev,
+                                       XCM_DDC_MODE_e      mode )
+{
+  if(mode == XCM_DDC_MODE_I2C_RDWR &&
+     dev->funcs & XCM_DDC_FUNC_SMBUS_READ_BLOCK)
+    return XCM_DDC_MODE_SMBUS;
+  if(mode != XCM_DDC_MODE_LEGACY)
+    return XCM_DDC_MODE_LEGACY;
+  return XCM_DDC_MODE_UNKNOWN;
+}
+
+static xcmDDCState_e xcmDDCModeState ( XCM_DDC_MODE_e      mode )
+{
+  switch(mode)
+  {
+  case XCM_DDC_MODE_SMBUS: return XCM_DDC_STATE_SMBUS;
+  case XCM_DDC_MODE_LEGACY: return XCM_DDC_STATE_SLAVE;
+  default: return XCM_DDC_STATE_BLOCK;
+  }
+}
+
+static void        xcmDDCTimeAdd     ( struct timespec   * ts,
+                                       long                us )
+{
+  ts->tv_sec += us / 1000000;
+  ts->tv_nsec += (us % 1000000) * 1000;
+  if(ts->tv_nsec >= 1000000000)
+  {
+    ++ts->tv_sec;
+    ts->tv_nsec -= 1000000000;
+  }
+}
+
+/* @internal
+ * microseconds until ts, 0 if passed */
+static long        xcmDDCUntil       ( const struct timespec * ts )
+{
+  struct timespec now;
+  long long us;
+
+  clock_gettime( CLOCK_MONOTONIC, &now );
+  us = (long long)(ts->tv_sec - now.tv_sec) * 1000000 +
+       (ts->tv_nsec - now.tv_nsec) / 1000;
+  return us > 0 ? (long)us : 0;
+}
+
+/* @internal
+ * microseconds until t is due, 0 if due */
+static long        xcmDDCTransactionWait (
+                                       const XcmDDCTransaction_s * t )
+{
+  return xcmDDCUntil( &t->due );
+}
+
+static void        xcmDDCTransactionInit (
+                                       XcmDDCTransaction_s * t,
+                                       XcmDDCDevice_s    * dev )
+{
+  memset( t, 0, sizeof(XcmDDCTransaction_s) );
+  t->dev = dev;
+  t->timer_fd = -1;
+  t->mode = xcmDDCModeFirst( dev );
+  t->state = xcmDDCModeState( t->mode );
+  t->blocks = 1;
+  t->delay_us = dev->delay_us ? dev->delay_us : XCM_DDC_DELAY_START;
+  clock_gettime( CLOCK_MONOTONIC, &t->due );
+  t->start = t->due;
+}
+
+/* @internal
+ * enter the next state after a delay */
+static void        xcmDDCTransactionNext (
+                                       XcmDDCTransaction_s * t,
+                                       xcmDDCState_e       state,
+                                       long                delay_us )
+{
+  t->state = state;
+  clock_gettime( CLOCK_MONOTONIC, &t->due );
+  xcmDDCTimeAdd( &t->due, delay_us );
+
+  if(t->timer_fd != -1)
+  {
+    struct itimerspec its;
+    memset( &its, 0, sizeof(its) );
+    its.it_value = t->due;
+    /* a zero it_value would disarm the timer */
+    if(its.it_value.tv_sec == 0 && its.it_value.tv_nsec == 0)
+      its.it_value.tv_nsec = 1;
+    timerfd_settime( t->timer_fd, TFD_TIMER_ABSTIME, &its, NULL );
+  }
+}
+
+static void        xcmDDCTransactionFinish (
+                                       XcmDDCTransaction_s * t,
+                                       XCM_DDC_ERROR_e     error )
+{
+  t->error = error;
+  t->state = XCM_DDC_STATE_DONE;
+  if(error == XCM_DDC_OK)
+  {
+    struct timespec now;
+    clock_gettime( CLOCK_MONOTONIC, &now );
+    t->dev->mode = t->mode;
+    t->dev->read_us = (now.tv_sec - t->start.tv_sec) * 1000000 +
+                      (now.tv_nsec - t->start.tv_nsec) / 1000;
+    if(t->mode == XCM_DDC_MODE_LEGACY && t->dev->delay_us != t->delay_us)
+    {
+      t->dev->delay_us = t->delay_us;
+      xcmDDCTimingStore( t->dev->name, t->delay_us );
+    }
+  }
+  if(t->timer_fd != -1)
+  {
+    /* keep the fd readable, so a poll loop comes back to collect */
+    struct itimerspec its;
+    memset( &its, 0, sizeof(its) );
+    its.it_value.tv_nsec = 1;
+    timerfd_settime( t->timer_fd, 0, &its, NULL );
+  }
+}
+
+/* @internal
+ * a legacy transfer was too fast: repeat the block with a doubled delay */
+static void        xcmDDCTransactionBackoff (
+                                       XcmDDCTransaction_s * t,
+                                       XCM_DDC_ERROR_e     error )
+{
+  if(t->mode != XCM_DDC_MODE_LEGACY || t->delay_us >= XCM_DDC_DELAY_MAX)
+  {
+    xcmDDCTransactionFinish( t, error );
+    return;
+  }
+
+  t->delay_us *= 2;
+  if(t->delay_us > XCM_DDC_DELAY_MAX)
+    t->delay_us = XCM_DDC_DELAY_MAX;
+  ++t->dev->backoffs;
+  xcmDDCTransactionNext( t, XCM_DDC_STATE_WRITE, t->delay_us );
+}
+
+/* @internal
+ * fetch one 128 byte EDID block in a single combined transaction:
+ * segment pointer, word offset and read */
+static int         xcmDDCReadBlock   ( XcmDDCDevice_s    * dev,
+                                       int                 block,
+                                       unsigned char     * buf )
+{
+  unsigned char segment = block / 2,
+                offset = (block % 2) * 128;
+  XcmDDCMsg_s msgs[3];
+  int n = 0;
+
+  if(!dev->transport->transfer)
+    return -1;
+
+  if(segment)
+  {
+    msgs[n].addr = 0x30;
+    msgs[n].read = 0;
+    msgs[n].len = 1;
+    msgs[n].buf = &segment;
+    ++n;
+  }
+  msgs[n].addr = 0x50;
+  msgs[n].read = 0;
+  msgs[n].len = 1;
+  msgs[n].buf = &offset;
+  ++n;
+  msgs[n].addr = 0x50;
+  msgs[n].read = 1;
+  msgs[n].len = 128;
+  msgs[n].buf = buf;
+  ++n;
+
+  return dev->transport->transfer( dev->handle, msgs, n );
+}
+
+/* @internal
+ * fetch one 128 byte EDID block in 32 byte SMBus I2C block reads;
+ * reaches only the first segment; call with dev->lock held */
+static int         xcmDDCReadBlockSMBus (
+                                       XcmDDCDevice_s    * dev,
+                                       int                 block,
+                                       unsigned char     * buf )
+{
+  int i;
+
+  if(block >= 2 || !dev->transport->smbus_read ||
+     xcmDDCDeviceSlave( dev, 0x50, 0 ) != 0)
+    return -1;
+
+  for(i = 0; i < 128; i += I2C_SMBUS_BLOCK_MAX)
+    if(dev->transport->smbus_read( dev->handle, block * 128 + i, &buf[i],
+                                   I2C_SMBUS_BLOCK_MAX ) != 0)
+      return -1;
+
+  return 0;
+}
+
+/* @internal
+ * account a received block and schedule the next one */
+static void        xcmDDCTransactionBlock (
+                                       XcmDDCTransaction_s * t )
+{
+  unsigned char * edid = (unsigned char*) t->data;
+
+  if(t->block == 0)
+  {
+    int blocks;
+    char * data;
+
+    if(!(edid[0] == 0 &&
+         edid[1] == 255 &&
+         edid[2] == 255 &&
+         edid[3] == 255 &&
+         edid[4] == 255 &&
+         edid[5] == 255 &&
+         edid[6] == 255 &&
+         edid[7] == 0))
+    {
+      /* a slow monitor may answer garbage before it settled */
+      xcmDDCTransactionBackoff( t, XCM_DDC_WRONG_EDID );
+      return;
+    }
+
+    blocks = 1 + edid[126];
+    if(t->blocks_max && blocks > t->blocks_max)
+      blocks = t->blocks_max;
+    if(blocks > 2)
+    {
+      data = realloc( t->data, blocks * 128 );
+      if(!data)
+      {
+        xcmDDCTransactionFinish( t, XCM_DDC_EDID_READ_FAIL );
+        return;
+      }
+      t->data = data;
+    }
+    t->blocks = blocks;
+  }
+
+  ++t->block;
+  t->size = t->block * 128;
+
+  if(t->block >= t->blocks ||
+     /* without combined transfers there is no segment pointer */
+     (t->mode != XCM_DDC_MODE_I2C_RDWR && t->block >= 2))
+    xcmDDCTransactionNext( t, XCM_DDC_STATE_DDCCI, 0 );
+  else if(t->mode == XCM_DDC_MODE_LEGACY)
+    xcmDDCTransactionNext( t, XCM_DDC_STATE_WRITE, t->delay_us );
+  else
+    xcmDDCTransactionNext( t, xcmDDCModeState( t->mode ), 0 );
+}
+
+/* @internal
+ * a transfer failed: try the next mode for the first block */
+static void        xcmDDCTransactionFallback (
+                                       XcmDDCTransaction_s * t )
+{
+  XCM_DDC_MODE_e mode = XCM_DDC_MODE_UNKNOWN;
+
+  if(t->block == 0)
+    mode = xcmDDCModeNext( t->dev, t->mode );
+
+  if(mode == XCM_DDC_MODE_UNKNOWN)
+    xcmDDCTransactionFinish( t, XCM_DDC_EDID_READ_FAIL );
+  else
+  {
+    t->mode = mode;
+    xcmDDCTransactionNext( t, xcmDDCModeState( mode ), 0 );
+  }
+}
+
+/** Function XcmDDCTransactionStep
+ *  @brief   advance a DDC transaction
+ *
+ *  Does nothing before the transaction is due. Otherwise it performs
+ *  the next short bus operation and schedules the following one without
+ *  sleeping.
+ *
+ *  @param[in,out] t                   the transaction
+ *  @return                            XCM_DDC_PENDING while not finished,
+ *                                     otherwise the transaction result
+ *
+ *  @version libXcm: 0.5.5
+ *  @since   2026/10/17 (libXcm: 0.5.5)
+ *  @date    2026/10/17
+ */
+XCM_DDC_ERROR_e   XcmDDCTransactionStep (
+                                       XcmDDCTransaction_s * t )
+{
+  unsigned char command[1];
+  int ret;
+
+  if(!t)
+    return XCM_DDC_NO_FILE;
+  if(t->state == XCM_DDC_STATE_DONE)
+    return t->error;
+
+  if(t->timer_fd != -1)
+  {
+    uint64_t expirations;
+    ret = read( t->timer_fd, &expirations, sizeof(expirations) );
+  }
+
+  if(t->deadline && xcmDDCExpired( t->deadline ))
+  {
+    xcmDDCTransactionFinish( t, XCM_DDC_TIMEOUT );
+    return t->error;
+  }
+
+  if(xcmDDCTransactionWait( t ))
+    return XCM_DDC_PENDING;
+
+  if(!t->data)
+  {
+    t->data = (char*)calloc(sizeof(char),256);
+    if(!t->data)
+    {
+      xcmDDCTransactionFinish( t, XCM_DDC_EDID_READ_FAIL );
+      return t->error;
+    }
+  }
+
+  pthread_mutex_lock( &t->dev->lock );
+  switch(t->state)
+  {
+  case XCM_DDC_STATE_BLOCK:
+    if(xcmDDCReadBlock( t->dev, t->block,
+                        (unsigned char*)t->data + t->block * 128 ) == 0)
+      xcmDDCTransactionBlock( t );
+    else
+      /* the adapter might not support combined transfers */
+      xcmDDCTransactionFallback( t );
+    break;
+  case XCM_DDC_STATE_SMBUS:
+    if(xcmDDCReadBlockSMBus( t->dev, t->block,
+                             (unsigned char*)t->data + t->block * 128 ) == 0)
+      xcmDDCTransactionBlock( t );
+    else
+      xcmDDCTransactionFallback( t );
+    break;
+  case XCM_DDC_STATE_SLAVE:
+    if(t->dev->slave == 0x50)
+      /* reused handle, nothing to settle */
+      xcmDDCTransactionNext( t, XCM_DDC_STATE_WRITE, 0 );
+    else if(xcmDDCDeviceSlave( t->dev, 0x50, 0 ) != 0)
+      xcmDDCTransactionFinish( t, XCM_DDC_PREPARE_FAIL );
+    else
+      xcmDDCTransactionNext( t, XCM_DDC_STATE_WRITE, t->delay_us );
+    break;
+  case XCM_DDC_STATE_WRITE:
+    command[0] = t->block * 128;
+    if(t->dev->transport->write( t->dev->handle, command, 1 ) == 1)
+      xcmDDCTransactionNext( t, XCM_DDC_STATE_READ, t->delay_us );
+    else if(t->dev->delay_us || t->block ||
+            t->delay_us < XCM_DDC_DELAY_PROBE)
+      /* a NAK from a monitor, which answered before, or from a slow one
+       * on first contact */
+      xcmDDCTransactionBackoff( t, XCM_DDC_PREPARE_FAIL );
+    else
+      /* most likely no monitor on the bus */
+      xcmDDCTransactionFinish( t, XCM_DDC_PREPARE_FAIL );
+    break;
+  case XCM_DDC_STATE_READ:
+    ret = t->dev->transport->read( t->dev->handle,
+                                   (unsigned char*)t->data + t->block * 128,
+                                   128 );
+    if(ret == 128)
+      xcmDDCTransactionBlock( t );
+    else
+      xcmDDCTransactionBackoff( t, XCM_DDC_EDID_READ_FAIL );
+    break;
+  case XCM_DDC_STATE_DDCCI:
+    if(xcmDDCDeviceSlave( t->dev, 0x37, 1 ) != 0)
+      xcmDDCTransactionFinish( t, XCM_DDC_PREPARE_FAIL );
+    else
+      xcmDDCTransactionFinish( t, XCM_DDC_OK );
+    break;
+  case XCM_DDC_STATE_DONE:
+    break;
+  }
+  pthread_mutex_unlock( &t->dev->lock );
+
+  return t->state == XCM_DDC_STATE_DONE ? t->error : XCM_DDC_PENDING;
+}
+
+/* @internal
+ * run a transaction to its end in the calling thread */
+static XCM_DDC_ERROR_e xcmDDCTransactionRun (
+                                       XcmDDCTransaction_s * t )
+{
+  XCM_DDC_ERROR_e error;
+
+  while((error = XcmDDCTransactionStep( t )) == XCM_DDC_PENDING)
+  {
+    long us = xcmDDCTransactionWait( t );
+    /* wake up at the deadline instead of sleeping past it */
+    if(t->deadline && xcmDDCUntil( t->deadline ) < us)
+      us = xcmDDCUntil( t->deadline );
+    if(us)
+      usleep( us );
+  }
+
+  return error;
+}
+
+/* @internal
+ * read the EDID with its extensions from a opened i2c device;
+ * blocks_max limits the number of blocks, 0 reads all; a optional deadline
+ * ends the read with XCM_DDC_TIMEOUT */
+static XCM_DDC_ERROR_e xcmDDCgetEDID ( XcmDDCDevice_s    * dev,
+                                       int                 blocks_max,
+                                       const struct timespec * deadline,
+                                       char             ** data,
+                                       size_t            * size )
+{
+  XcmDDCTransaction_s t;
+  XCM_DDC_ERROR_e error;
+  char stamp[64];
+
+  if(xcmDDCCacheLookup( dev, blocks_max, stamp, sizeof(stamp), data, size ))
+    return XCM_DDC_OK;
+
+  pthread_mutex_lock( &dev->lock );
+  xcmDDCTransactionInit( &t, dev );
+  pthread_mutex_unlock( &dev->lock );
+  t.blocks_max = blocks_max;
+  t.deadline = deadline;
+  error = xcmDDCTransactionRun( &t );
+
+  /* the data is handed over even for a wrong header */
+  *data = t.data;
+  if(error == XCM_DDC_OK)
+  {
+    *size = t.size;
+    xcmDDCCacheStore( dev, blocks_max, stamp, t.data, t.size );
+  }
+
+  return error;
+}
+
+/** Function XcmDDCDeviceEDIDStart
+ *  @brief   start reading a EDID without blocking
+ *
+ *  The transaction replaces the sleeps of XcmDDCgetEDID() by deadlines.
+ *  Put XcmDDCTransactionFd() into a poll() or epoll loop, or wait for
+ *  XcmDDCTransactionTimeout(), and call XcmDDCTransactionStep() when it
+ *  becomes ready, until it returns something else than XCM_DDC_PENDING.
+ *  Each step performs at most one short i2c bus operation. Run only one
+ *  transaction at a time on a device.
+ *
+ *  @param[in]     dev                 the device; the transaction takes
+ *                                     its own reference
+ *  @param[out]    t                   the new transaction
+ *  @return                            error code
+ *
+ *  @version libXcm: 0.5.5
+ *  @since   2026/10/17 (libXcm: 0.5.5)
+ *  @date    2026/10/17
+ */
+XCM_DDC_ERROR_e   XcmDDCDeviceEDIDStart (
+                                       XcmDDCDevice_s    * dev,
+                                       XcmDDCTransaction_s ** t )
+{
+  XcmDDCTransaction_s * tr;
+
+  if(!dev || !t)
+    return XCM_DDC_NO_FILE;
+  *t = NULL;
+
+  tr = calloc( 1, sizeof(XcmDDCTransaction_s) );
+  if(!tr)
+    return XCM_DDC_NO_FILE;
+
+  pthread_mutex_lock( &dev->lock );
+  xcmDDCTransactionInit( tr, dev );
+  pthread_mutex_unlock( &dev->lock );
+  tr->timer_fd = timerfd_create( CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC );
+  if(tr->timer_fd == -1)
+  {
+    free( tr );
+    return XCM_DDC_NO_FILE;
+  }
+
+  pthread_mutex_lock( &xcm_ddc_pool_lock );
+  ++dev->refs;
+  pthread_mutex_unlock( &xcm_ddc_pool_lock );
+
+  /* the first step is due now */
+  xcmDDCTransactionNext( tr, tr->state, 0 );
+
+  *t = tr;
+  return XCM_DDC_OK;
+}
+
+/** Function XcmDDCEDIDStart
+ *  @brief   start reading a EDID from a pooled device without blocking
+ *
+ *  See XcmDDCDeviceEDIDStart().
+ *
+ *  @param[in]     device_name         system specific device name
+ *  @param[out]    t                   the new transaction
+ *  @return                            error code
+ *
+ *  @version libXcm: 0.5.5
+ *  @since   2026/10/17 (libXcm: 0.5.5)
+ *  @date    2026/10/17
+ */
+XCM_DDC_ERROR_e   XcmDDCEDIDStart    ( const char        * device_name,
+                                       XcmDDCTransaction_s ** t )
+{
+  XcmDDCDevice_s * dev = NULL;
+  XCM_DDC_ERROR_e error = XcmDDCPoolGet( device_name, &dev );
+
+  if(error == XCM_DDC_OK)
+    error = XcmDDCDeviceEDIDStart( dev, t );
+  XcmDDCDeviceRelease( &dev );
+
+  return error;
+}
+
+/** Function XcmDDCTransactionFd
+ *  @brief   file descriptor to poll for POLLIN
+ *
+ *  The descriptor becomes readable, when the next step is due or the
+ *  transaction is finished.
+ *
+ *  @version libXcm: 0.5.5
+ *  @since   2026/10/17 (libXcm: 0.5.5)
+ *  @date    2026/10/17
+ */
+int               XcmDDCTransactionFd( const XcmDDCTransaction_s * t )
+{
+  return t ? t->timer_fd : -1;
+}
+
+/** Function XcmDDCTransactionTimeout
+ *  @brief   milliseconds until the next step is due
+ *
+ *  @return                            0 for now, -1 for finished
+ *
+ *  @version libXcm: 0.5.5
+ *  @since   2026/10/17 (libXcm: 0.5.5)
+ *  @date    2026/10/17
+ */
+int               XcmDDCTransactionTimeout (
+                                       const XcmDDCTransaction_s * t )
+{
+  if(!t || t->state == XCM_DDC_STATE_DONE)
+    return -1;
+  return (int)((xcmDDCTransactionWait( t ) + 999) / 1000);
+}
+
+/** Function XcmDDCTransactionGetEDID
+ *  @brief   take the EDID of a finished transaction
+ *
+ *  @param[in,out] t                   the transaction
+ *  @param[out]    data                EDID data, mallocd for the user
+ *  @param[out]    size                size of memory in data
+ *  @return                            the transaction result
+ *
+ *  @version libXcm: 0.5.5
+ *  @since   2026/10/17 (libXcm: 0.5.5)
+ *  @date    2026/10/17
+ */
+XCM_DDC_ERROR_e   XcmDDCTransactionGetEDID (
+                                       XcmDDCTransaction_s * t,
+                                       char             ** data,
+                                       size_t            * size )
+{
+  if(!t || !data || !size)
+    return XCM_DDC_NO_FILE;
+  if(t->state != XCM_DDC_STATE_DONE)
+    return XCM_DDC_PENDING;
+  if(t->error == XCM_DDC_OK)
+  {
+    *data = t->data;
+    *size = t->size;
+    t->data = NULL;
+    t->size = 0;
+  }
+  return t->error;
+}
+
+/** Function XcmDDCTransactionRelease
+ *  @brief   cancel or free a transaction
+ *
+ *  @param[in,out] t                   the transaction; is set to NULL
+ *
+ *  @version libXcm: 0.5.5
+ *  @since   2026/10/17 (libXcm: 0.5.5)
+ *  @date    2026/10/17
+ */
+void              XcmDDCTransactionRelease (
+                                       XcmDDCTransaction_s ** t )
+{
+  if(!t || !*t)
+    return;
+
+  if((*t)->timer_fd != -1)
+    close( (*t)->timer_fd );
+  XcmDDCDeviceRelease( &(*t)->dev );
+  free( (*t)->data );
+  free( *t );
+  *t = NULL;
+}
+
+/** Function XcmDDCDeviceGetEDID
+ *  @brief   read the EDID from a opened device
+ *
+ *  @param[in]     dev                 the device handle
+ *  @param[out]    data                empty pointer to EDID data, will be 
+ *                                     mallocd for the user
+ *  @param[out]    size                size of memory in data
+ *  @return                            error code
+ *
+ *  @version libXcm: 0.5.5
+ *  @since   2026/10/17 (libXcm: 0.5.5)
+ *  @date    2026/10/17
+ */
+XCM_DDC_ERROR_e   XcmDDCDeviceGetEDID( XcmDDCDevice_s    * dev,
+                                       char             ** data,
+                                       size_t            * size )
+{
+  if(!dev || !data || !size)
+    return XCM_DDC_NO_FILE;
+
+  return xcmDDCgetEDID( dev, 0, NULL, data, size );
+}
+
+/** Function XcmDDCgetEDID
+ *  @brief   obtain all monitors i2c device names
+ *
+ *  The complete E-EDID is read, the base block and all announced
+ *  extension blocks. Blocks beyond 256 bytes are addressed with the
+ *  E-DDC segment pointer. Devices, which answer with a EDID, are kept in
+ *  the process wide pool, see XcmDDCPoolGet(). Buses without a monitor
+ *  are closed again.
+ *
+ *  @param[in]     device_name         system specific device name
+ *  @param[out]    data                empty pointer to EDID data, will be 
+ *                                     mallocd for the user
+ *  @param[out]    size                size of memory in data
+ *  @return                            error code
+ *
+ *  @version libXcm: 0.5.5
+ *  @since   2010/12/28 (libXcm: 0.4,0)
+ *  @date    2026/10/17
+ */
+XCM_DDC_ERROR_e   XcmDDCgetEDID      ( const char        * device_name,
+                                       char             ** data,
+                                       size_t            * size )
+{
+  XcmDDCDevice_s * dev = NULL;
+  XCM_DDC_ERROR_e error;
+
+  if(!device_name)
+    return XCM_DDC_NO_FILE;
+
+  /* like XcmDDClist(), keep only monitors in the pool */
+  dev = xcmDDCPoolFind( device_name );
+  if(dev)
+    error = XCM_DDC_OK;
+  else
+    error = XcmDDCDeviceOpen( device_name, &dev );
+  if(error == XCM_DDC_OK)
+    error = xcmDDCgetEDID( dev, 0, NULL, data, size );
+
+  if(error == XCM_DDC_OK)
+    xcmDDCPoolAdopt( dev );
+  else
+    /* no monitor or a unplugged one */
+    xcmDDCPoolDrop( dev );
+  XcmDDCDeviceRelease( &dev );
+
+  return error;
+}
+
+
+/* hotplug events */
+
+#define XCM_DDC_UEVENT_SIZE 8192
+/* the kernel sends uevents as root */
+#ifndef XCM_DDC_UEVENT_UID
+#define XCM_DDC_UEVENT_UID 0
+#endif
+
+typedef struct {
+  char             * name;             /* connector, e.g. card0-DP-1 */
+  char               stamp[96];        /* status, epoch or EDID hash */
+  int                seen;             /* found in the last scan */
+} xcmDDCHotplugState_s;
+
+struct XcmDDCHotplug_s_ {
+  int                fd;               /* NETLINK_KOBJECT_UEVENT socket */
+  xcmDDCHotplugState_s * states;
+  int                n;
+};
+
+/* @internal
+ * fingerprint of a connector: status and hotplug epoch; without epoch
+ * attribute a hash of the cached EDID tells about swapped monitors */
+static void        xcmDDCHotplugStamp( const char        * connector,
+                                       char              * stamp,
+                                       int                 size )
+{
+  int len = xcmDDCSysfsRead( connector, "status", stamp, size );
+
+  if(len < 0)
+  {
+    stamp[0] = '\000';
+    return;
+  }
+  if(len + 2 >= size)
+    return;
+  stamp[len++] = ':';
+  if(xcmDDCSysfsRead( connector, "epoch", stamp + len, size - len ) < 0)
+  {
+    char path[sizeof(XCM_DDC_SYSFS_DRM) + 2*256 + 8], * edid = NULL;
+    size_t edid_size = 0;
+
+    snprintf( path, sizeof(path), "%s/edid", connector );
+    xcmDDCSysfsReadAll( path, &edid, &edid_size );
+    snprintf( stamp + len, size - len, "%016llx",
+              edid ? (unsigned long long)xcmDDCHash( (unsigned char*)edid,
+                                                     edid_size ) : 0ULL );
+    free( edid );
+  }
+}
+
+/* @internal
+ * a new zeroed element at the end of changed; the array grows by one, as
+ * it is extended over several scans without knowing its capacity */
+static XcmDDCConnector_s * xcmDDCConnectorAppend (
+                                       XcmDDCConnector_s ** changed,
+                                       int               * count )
+{
+  XcmDDCConnector_s * l = realloc( *changed,
+                                   (*count + 1) * sizeof(XcmDDCConnector_s) );
+  if(!l)
+    return NULL;
+  *changed = l;
+  memset( &l[*count], 0, sizeof(XcmDDCConnector_s) );
+
+  return &l[(*count)++];
+}
+
+/* @internal
+ * compare the connectors of card with the last scan; card NULL means all
+ * cards and connector_id -1 all connectors; changed receives a
+ * XcmDDCConnector_s with EDID for each difference, if not NULL */
+static void        xcmDDCHotplugScan ( XcmDDCHotplug_s   * hp,
+                                       const char        * card,
+                                       long                connector_id,
+                                       XcmDDCConnector_s ** changed,
+                                       int               * count )
+{
+  DIR * dir = opendir( XCM_DDC_SYSFS_DRM );
+  struct dirent * entry;
+  size_t card_len = card ? strlen( card ) : 0;
+  int i;
+
+  if(!dir)
+    return;
+
+  for(i = 0; i < hp->n; ++i)
+    hp->states[i].seen = 0;
+
+  while((entry = readdir( dir )) != NULL)
+  {
+    char path[sizeof(XCM_DDC_SYSFS_DRM) + 256], stamp[96];
+    xcmDDCHotplugState_s * state = NULL;
+
+    if(!xcmDDCSysfsIsConnector( entry->d_name ) ||
+       (card && (strncmp( entry->d_name, card, card_len ) != 0 ||
+                 entry->d_name[card_len] != '-')))
+      continue;
+    snprintf( path, sizeof(path), XCM_DDC_SYSFS_DRM "%s", entry->d_name );
+
+    if(connector_id >= 0)
+    {
+      char id[32];
+      /* connector_id exists since Linux 6.3 */
+      if(xcmDDCSysfsRead( path, "connector_id", id, sizeof(id) ) >= 0 &&
+         atol( id ) != connector_id)
+        continue;
+    }
+
+    for(i = 0; i < hp->n; ++i)
+      if(strcmp( hp->states[i].name, entry->d_name ) == 0)
+        state = &hp->states[i];
+    if(!state)
+    {
+      xcmDDCHotplugState_s * s = realloc( hp->states,
+                                   (hp->n + 1) * sizeof(xcmDDCHotplugState_s) );
+      if(!s)
+        continue;
+      hp->states = s;
+      state = &hp->states[hp->n];
+      memset( state, 0, sizeof(xcmDDCHotplugState_s) );
+      state->name = strdup( entry->d_name );
+      if(!state->name)
+        continue;
+      ++hp->n;
+    }
+    state->seen = 1;
+
+    xcmDDCHotplugStamp( path, stamp, sizeof(stamp) );
+    if(strcmp( stamp, state->stamp ) == 0)
+      continue;
+    snprintf( state->stamp, sizeof(state->stamp), "%s", stamp );
+
+    if(changed)
+    {
+      XcmDDCConnector_s * c;
+      char status[32];
+      char * bus;
+
+      c = xcmDDCConnectorAppend( changed, count );
+      if(!c)
+        continue;
+      c->name = strdup( entry->d_name );
+      if(xcmDDCSysfsRead( path, "status", status, sizeof(status) ) < 0)
+        snprintf( status, sizeof(status), "unknown" );
+      c->status = strdup( status );
+      bus = xcmDDCSysfsBus( path );
+      if(bus)
+      {
+        c->device = malloc( sizeof(I2C_DIR) + strlen( bus ) );
+        if(c->device)
+          sprintf( c->device, I2C_DIR "%s", bus );
+        free( bus );
+      }
+      if(strcmp( status, "connected" ) == 0)
+      {
+        char edid[sizeof(path) + 8];
+        snprintf( edid, sizeof(edid), "%s/edid", path );
+        xcmDDCSysfsReadAll( edid, &c->edid, &c->edid_size );
+        c->sysfs = c->edid != NULL;
+        if(!c->edid && c->device)
+          XcmDDCgetEDID( c->device, &c->edid, &c->edid_size );
+      }
+    }
+  }
+  closedir( dir );
+
+  /* connectors of a unplugged MST hub disappear */
+  for(i = 0; i < hp->n; )
+  {
+    xcmDDCHotplugState_s * state = &hp->states[i];
+    int match = !card ||
+                (strncmp( state->name, card, card_len ) == 0 &&
+                 state->name[card_len] == '-');
+
+    if(state->seen || !match || connector_id >= 0)
+    {
+      ++i;
+      continue;
+    }
+
+    if(changed)
+    {
+      XcmDDCConnector_s * c = xcmDDCConnectorAppend( changed, count );
+      if(c)
+      {
+        c->name = state->name;
+        c->status = strdup( "disconnected" );
+        state->name = NULL;
+      }
+    }
+    free( state->name );
+    hp->states[i] = hp->states[--hp->n];
+  }
+}
+
+/** Function XcmDDCHotplugOpen
+ *  @brief   listen to monitor changes
+ *
+ *  The listener subscribes to kernel uevents of the drm subsystem. Put
+ *  XcmDDCHotplugFd() into a poll() loop and call XcmDDCHotplugRead(),
+ *  when it becomes readable. This replaces periodic rescans with
+ *  XcmDDClist(). It needs the DRM connectors in sysfs.
+ *
+ *  @param[out]    hotplug             the new listener
+ *  @return                            error code
+ *
+ *  @version libXcm: 0.5.5
+ *  @since   2026/10/17 (libXcm: 0.5.5)
+ *  @date    2026/10/17
+ */
+XCM_DDC_ERROR_e   XcmDDCHotplugOpen  ( XcmDDCHotplug_s  ** hotplug )
+{
+  XcmDDCHotplug_s * hp;
+  struct sockaddr_nl addr;
+  int on = 1;
+
+  if(!hotplug)
+    return XCM_DDC_NO_FILE;
+  *hotplug = NULL;
+
+  hp = calloc( 1, sizeof(XcmDDCHotplug_s) );
+  if(!hp)
+    return XCM_DDC_NO_FILE;
+
+  hp->fd = socket( AF_NETLINK, SOCK_DGRAM | SOCK_NONBLOCK | SOCK_CLOEXEC,
+                   NETLINK_KOBJECT_UEVENT );
+  memset( &addr, 0, sizeof(addr) );
+  addr.nl_family = AF_NETLINK;
+  addr.nl_groups = 1;                  /* kernel uevents */
+  if(hp->fd == -1 ||
+     /* the sender credentials tell kernel uevents from others */
+     setsockopt( hp->fd, SOL_SOCKET, SO_PASSCRED, &on, sizeof(on) ) != 0 ||
+     bind( hp->fd, (struct sockaddr*)&addr, sizeof(addr) ) != 0)
+  {
+    if(hp->fd != -1)
+      close( hp->fd );
+    free( hp );
+    return XCM_DDC_NO_FILE;
+  }
+
+  /* the reference to compare later events with */
+  xcmDDCHotplugScan( hp, NULL, -1, NULL, NULL );
+
+  *hotplug = hp;
+  return XCM_DDC_OK;
+}
+
+/** Function XcmDDCHotplugFd
+ *  @brief   file descriptor to poll for POLLIN
+ *
+ *  @version libXcm: 0.5.5
+ *  @since   2026/10/17 (libXcm: 0.5.5)
+ *  @date    2026/10/17
+ */
+int               XcmDDCHotplugFd    ( const XcmDDCHotplug_s * hotplug )
+{
+  return hotplug ? hotplug->fd : -1;
+}
+
+/** Function XcmDDCHotplugRead
+ *  @brief   collect pending monitor changes
+ *
+ *  All pending uevents are consumed without blocking. Only connectors,
+ *  whose status or hotplug epoch changed, are reported, and only their
+ *  EDID is read. Removed connectors are reported as disconnected.
+ *  Datagrams, which do not come from the kernel, are ignored. When the
+ *  kernel dropped uevents on a full socket buffer, all connectors are
+ *  compared.
+ *
+ *  @param[in,out] hotplug             the listener
+ *  @param[out]    changed             the changed connectors, release with
+ *                                     XcmDDCConnectorListRelease()
+ *  @param[out]    count               number of changed connectors; 0
+ *                                     for unrelated events
+ *  @return                            error code
+ *
+ *  @version libXcm: 0.5.5
+ *  @since   2026/10/17 (libXcm: 0.5.5)
+ *  @date    2026/10/17
+ */
+XCM_DDC_ERROR_e   XcmDDCHotplugRead  ( XcmDDCHotplug_s   * hotplug,
+                                       XcmDDCConnector_s ** changed,
+                                       int               * count )
+{
+  char * buf;
+  ssize_t len;
+
+  if(!hotplug || !changed || !count)
+    return XCM_DDC_NO_FILE;
+  *changed = NULL;
+  *count = 0;
+
+  buf = malloc( XCM_DDC_UEVENT_SIZE + 1 );
+  if(!buf)
+    return XCM_DDC_NO_FILE;
+
+  for(;;)
+  {
+    const char * p = buf, * end;
+    const char * subsystem = NULL, * devpath = NULL, * card;
+    long connector_id = -1;
+    char card_name[64];
+    struct sockaddr_nl addr;
+    char control[CMSG_SPACE(sizeof(struct ucred))];
+    struct iovec iov;
+    struct msghdr msg;
+    struct cmsghdr * cmsg;
+    const struct ucred * cred = NULL;
+
+    memset( &addr, 0, sizeof(addr) );
+    memset( &msg, 0, sizeof(msg) );
+    iov.iov_base = buf;
+    iov.iov_len = XCM_DDC_UEVENT_SIZE;
+    msg.msg_name = &addr;
+    msg.msg_namelen = sizeof(addr);
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = control;
+    msg.msg_controllen = sizeof(control);
+
+    len = recvmsg( hotplug->fd, &msg, 0 );
+    if(len < 0 && errno == ENOBUFS)
+    {
+      /* uevents were lost; any connector might have changed */
+      xcmDDCHotplugScan( hotplug, NULL, -1, changed, count );
+      continue;
+    }
+    if(len < 0 && errno == EINTR)
+      continue;
+    if(len <= 0)
+      break;
+
+    /* only the kernel: root credentials and, on netlink, port id 0 */
+    for(cmsg = CMSG_FIRSTHDR( &msg ); cmsg; cmsg = CMSG_NXTHDR( &msg, cmsg ))
+      if(cmsg->cmsg_level == SOL_SOCKET &&
+         cmsg->cmsg_type == SCM_CREDENTIALS)
+        cred = (const struct ucred*)CMSG_DATA( cmsg );
+    if(!cred || cred->uid != XCM_DDC_UEVENT_UID ||
+       (msg.msg_namelen >= sizeof(addr) && addr.nl_family == AF_NETLINK &&
+        addr.nl_pid != 0))
+      continue;
+
+    end = buf + len;
+    buf[len] = '\000';
+    /* "action@devpath" followed by KEY=value strings */
+    for(p += strlen( p ) + 1; p < end; p += strlen( p ) + 1)
+    {
+      if(strncmp( p, "SUBSYSTEM=", 10 ) == 0)
+        subsystem = p + 10;
+      else if(strncmp( p, "DEVPATH=", 8 ) == 0)
+        devpath = p + 8;
+      else if(strncmp( p, "CONNECTOR=", 10 ) == 0)
+        connector_id = atol( p + 10 );
+    }
+    if(!subsystem || strcmp( subsystem, "drm" ) != 0)
+      continue;
+
+    /* DEVPATH=/devices/.../drm/card0 */
+    card = devpath ? strrchr( devpath, '/' ) : NULL;
+    if(card && strncmp( card + 1, "card", 4 ) == 0 && !strchr( card, '-' ))
+      snprintf( card_name, sizeof(card_name), "%s", card + 1 );
+    else
+      card_name[0] = '\000';
+
+    xcmDDCHotplugScan( hotplug, card_name[0] ? card_name : NULL,
+                       connector_id, changed, count );
+  }
+  free( buf );
+
+  return XCM_DDC_OK;
+}
+
+/** Function XcmDDCHotplugRelease
+ *  @brief   close a listener
+ *
+ *  @param[in,out] hotplug             the listener; is set to NULL
+ *
+ *  @version libXcm: 0.5.5
+ *  @since   2026/10/17 (libXcm: 0.5.5)
+ *  @date    2026/10/17
+ */
+void              XcmDDCHotplugRelease(XcmDDCHotplug_s  ** hotplug )
+{
+  int i;
+
+  if(!hotplug || !*hotplug)
+    return;
+
+  close( (*hotplug)->fd );
+  for(i = 0; i < (*hotplug)->n; ++i)
+    free( (*hotplug)->states[i].name );
+  free( (*hotplug)->states );
+  free( *hotplug );
+  *hotplug = NULL;
+}
+
+
+/* DDC/CI MCCS access */
+
+#define XCM_DDC_CI_ADDRESS      0x37   /* i2c slave of DDC/CI */
+#define XCM_DDC_CI_DEST         0x6e   /* display write address */
+#define XCM_DDC_CI_HOST         0x51   /* host source address */
+#define XCM_DDC_CI_REPLY_XOR    0x50   /* checksum start of replies */
+#define XCM_DDC_VCP_REPLY_DELAY 40000  /* MCCS: request to reply */
+#define XCM_DDC_VCP_CMD_DELAY   50000  /* MCCS: between messages */
+#define XCM_DDC_VCP_RETRIES     3
+
+/* @internal
+ * send a DDC/CI message with length byte and checksum;
+ * call with dev->lock held */
+static int         xcmDDCCISend      ( XcmDDCDevice_s    * dev,
+                                       const unsigned char * payload,
+                                       int                 len )
+{
+  unsigned char msg[40];
+  int i;
+
+  msg[0] = XCM_DDC_CI_HOST;
+  msg[1] = 0x80 | len;
+  memcpy( &msg[2], payload, len );
+  msg[2 + len] = XCM_DDC_CI_DEST;
+  for(i = 0; i < 2 + len; ++i)
+    msg[2 + len] ^= msg[i];
+
+  if(xcmDDCDeviceSlave( dev, XCM_DDC_CI_ADDRESS, 1 ) != 0)
+    return -1;
+  return dev->transport->write( dev->handle, msg, 3 + len ) == 3 + len ?
+         0 : -1;
+}
+
+/* @internal
+ * read a DDC/CI reply and verify its framing and checksum;
+ * returns the payload length or a negated XCM_DDC_ERROR_e;
+ * call with dev->lock held */
+static int         xcmDDCCIReceive   ( XcmDDCDevice_s    * dev,
+                                       unsigned char     * reply,
+                                       int                 size )
+{
+  unsigned char chk = XCM_DDC_CI_REPLY_XOR;
+  int i, len;
+
+  if(xcmDDCDeviceSlave( dev, XCM_DDC_CI_ADDRESS, 1 ) != 0 ||
+     dev->transport->read( dev->handle, reply, size ) != size)
+    return -XCM_DDC_EDID_READ_FAIL;
+
+  len = reply[1] & 0x7f;
+  if(reply[0] != XCM_DDC_CI_DEST || !(reply[1] & 0x80) || 3 + len > size)
+    return -XCM_DDC_WRONG_REPLY;
+  for(i = 0; i < 2 + len; ++i)
+    chk ^= reply[i];
+  if(chk != reply[2 + len])
+    return -XCM_DDC_CHECKSUM;
+
+  return len;
+}
+
+typedef struct {
+  XcmDDCDevice_s   * dev;
+  int                current;          /* feature index in progress or -1 */
+  int                waiting;          /* request sent, reply pending */
+  int                retries;
+  struct timespec    ready;            /* earliest next bus access */
+} xcmDDCVCPQueue_s;
+
+static int         xcmDDCTimeBefore  ( const struct timespec * a,
+                                       const struct timespec * b )
+{
+  return a->tv_sec < b->tv_sec ||
+         (a->tv_sec == b->tv_sec && a->tv_nsec < b->tv_nsec);
+}
+
+/* @internal
+ * next feature of the queue device after index from */
+static int         xcmDDCVCPNext     ( XcmDDCVCP_s       * features,
+                                       int                 n,
+                                       XcmDDCDevice_s    * dev,
+                                       int                 from )
+{
+  int i;
+  for(i = from + 1; i < n; ++i)
+    if(features[i].dev == dev)
+      return i;
+  return -1;
+}
+
+/* @internal
+ * perform one bus operation of a queue */
+static void        xcmDDCVCPStep     ( xcmDDCVCPQueue_s  * q,
+                                       XcmDDCVCP_s       * f )
+{
+  unsigned char msg[8], reply[16];
+  long delay = XCM_DDC_VCP_CMD_DELAY;
+  int done = 0, ret;
+
+  pthread_mutex_lock( &q->dev->lock );
+  if(!q->waiting)
+  {
+    if(f->set)
+    {
+      msg[0] = 0x03;
+      msg[1] = f->code;
+      msg[2] = (f->value >> 8) & 0xff;
+      msg[3] = f->value & 0xff;
+      ret = xcmDDCCISend( q->dev, msg, 4 );
+      done = 1;
+    } else
+    {
+      msg[0] = 0x01;
+      msg[1] = f->code;
+      ret = xcmDDCCISend( q->dev, msg, 2 );
+      q->waiting = ret == 0;
+      delay = XCM_DDC_VCP_REPLY_DELAY;
+    }
+    f->error = ret == 0 ? XCM_DDC_OK : XCM_DDC_PREPARE_FAIL;
+    if(ret != 0)
+      done = 1;
+  } else
+  {
+    q->waiting = 0;
+    ret = xcmDDCCIReceive( q->dev, reply, 11 );
+    if(ret == 0)
+      /* null message: the display is busy */
+      f->error = XCM_DDC_WRONG_REPLY;
+    else if(ret < 0)
+      f->error = -ret;
+    else if(ret != 8 || reply[2] != 0x02 || reply[4] != f->code)
+      f->error = XCM_DDC_WRONG_REPLY;
+    else if(reply[3] != 0)
+      f->error = XCM_DDC_VCP_UNSUPPORTED;
+    else
+    {
+      f->type = reply[5];
+      f->max = (reply[6] << 8) | reply[7];
+      f->value = (reply[8] << 8) | reply[9];
+      f->error = XCM_DDC_OK;
+    }
+
+    if(f->error == XCM_DDC_OK || f->error == XCM_DDC_VCP_UNSUPPORTED ||
+       ++q->retries >= XCM_DDC_VCP_RETRIES)
+      done = 1;
+  }
+  clock_gettime( CLOCK_MONOTONIC, &q->ready );
+  xcmDDCTimeAdd( &q->ready, delay );
+  /* later calls respect the delay as well */
+  q->dev->ci_ready = q->ready;
+  pthread_mutex_unlock( &q->dev->lock );
+
+  if(done)
+  {
+    q->retries = 0;
+    q->current = -1;
+  }
+}
+
+/** Function XcmDDCVCPBatch
+ *  @brief   get and set many MCCS VCP features on many devices
+ *
+ *  The features are processed in order per device. While one display
+ *  waits for the MCCS reply and inter command delays, the others are
+ *  served, so a batch over several monitors takes about as long as the
+ *  longest queue of a single monitor. Replies are verified for framing
+ *  and checksum; failed gets are retried.
+ *
+ *  @param[in,out] features            array of n features
+ *  @param[in]     n                   number of features
+ *  @return                            the first error or XCM_DDC_OK
+ *
+ *  @version libXcm: 0.5.5
+ *  @since   2026/10/17 (libXcm: 0.5.5)
+ *  @date    2026/10/17
+ */
+XCM_DDC_ERROR_e   XcmDDCVCPBatch     ( XcmDDCVCP_s       * features,
+                                       int                 n )
+{
+  xcmDDCVCPQueue_s * queues;
+  XCM_DDC_ERROR_e error = XCM_DDC_OK;
+  int i, j, nq = 0;
+
+  if(!features || n <= 0)
+    return XCM_DDC_NO_FILE;
+
+  queues = calloc( n, sizeof(xcmDDCVCPQueue_s) );
+  if(!queues)
+    return XCM_DDC_NO_FILE;
+
+  for(i = 0; i < n; ++i)
+  {
+    features[i].error = XCM_DDC_PENDING;
+    if(!features[i].dev)
+    {
+      features[i].error = XCM_DDC_NO_FILE;
+      continue;
+    }
+    for(j = 0; j < nq; ++j)
+      if(queues[j].dev == features[i].dev)
+        break;
+    if(j == nq)
+    {
+      queues[nq].dev = features[i].dev;
+      queues[nq].current = i;
+      pthread_mutex_lock( &features[i].dev->lock );
+      queues[nq].ready = features[i].dev->ci_ready;
+      pthread_mutex_unlock( &features[i].dev->lock );
+      ++nq;
+    }
+  }
+
+  for(;;)
+  {
+    struct timespec now, next;
+    int active = 0;
+
+    clock_gettime( CLOCK_MONOTONIC, &now );
+    for(j = 0; j < nq; ++j)
+    {
+      xcmDDCVCPQueue_s * q = &queues[j];
+
+      if(q->current < 0)
+        continue;
+      if(!xcmDDCTimeBefore( &now, &q->ready ))
+      {
+        int current = q->current;
+        xcmDDCVCPStep( q, &features[current] );
+        if(q->current < 0)
+          q->current = xcmDDCVCPNext( features, n, q->dev, current );
+      }
+      if(q->current < 0)
+        continue;
+      if(!active++ || xcmDDCTimeBefore( &q->ready, &next ))
+        next = q->ready;
+    }
+    if(!active)
+      break;
+
+    clock_gettime( CLOCK_MONOTONIC, &now );
+    if(xcmDDCTimeBefore( &now, &next ))
+      clock_nanosleep( CLOCK_MONOTONIC, TIMER_ABSTIME, &next, NULL );
+  }
+
+  for(i = 0; i < n; ++i)
+    if(features[i].error != XCM_DDC_OK)
+    {
+      error = features[i].error;
+      break;
+    }
+
+  free( queues );
+  return error;
+}
+
+/** Function XcmDDCGetVCP
+ *  @brief   read a MCCS VCP feature
+ *
+ *  @param[in]     dev                 the device handle
+ *  @param[in]     code                VCP code, e.g. 0x10 for luminance
+ *  @param[out]    value               current value
+ *  @param[out]    max                 optional maximum value
+ *  @return                            error code
+ *
+ *  @version libXcm: 0.5.5
+ *  @since   2026/10/17 (libXcm: 0.5.5)
+ *  @date    2026/10/17
+ */
+XCM_DDC_ERROR_e   XcmDDCGetVCP       ( XcmDDCDevice_s    * dev,
+                                       unsigned char       code,
+                                       int               * value,
+                                       int               * max )
+{
+  XcmDDCVCP_s f;
+  XCM_DDC_ERROR_e error;
+
+  memset( &f, 0, sizeof(f) );
+  f.dev = dev;
+  f.code = code;
+  error = XcmDDCVCPBatch( &f, 1 );
+  if(error == XCM_DDC_OK)
+  {
+    if(value)
+      *value = f.value;
+    if(max)
+      *max = f.max;
+  }
+
+  return error;
+}
+
+/** Function XcmDDCSetVCP
+ *  @brief   write a MCCS VCP feature
+ *
+ *  @param[in]     dev                 the device handle
+ *  @param[in]     code                VCP code, e.g. 0x10 for luminance
+ *  @param[in]     value               new value
+ *  @return                            error code
+ *
+ *  @version libXcm: 0.5.5
+ *  @since   2026/10/17 (libXcm: 0.5.5)
+ *  @date    2026/10/17
+ */
+XCM_DDC_ERROR_e   XcmDDCSetVCP       ( XcmDDCDevice_s    * dev,
+                                       unsigned char       code,
+                                       int                 value )
+{
+  XcmDDCVCP_s f;
+
+  memset( &f, 0, sizeof(f) );
+  f.dev = dev;
+  f.code = code;
+  f.set = 1;
+  f.value = value;
+
+  return XcmDDCVCPBatch( &f, 1 );
+}
+
+
+/* MCCS capabilities */
+
+#define XCM_DDC_CAPS_DELAY      50000  /* MCCS: capabilities reply */
+#define XCM_DDC_CAPS_MAX        8192
+
+typedef struct xcmDDCCapsEntry_s_ {
+  uint64_t           hash;             /* EDID hash */
+  XcmDDCCaps_s     * caps;
+  struct xcmDDCCapsEntry_s_ * next;
+} xcmDDCCapsEntry_s;
+
+static pthread_mutex_t xcm_ddc_caps_lock = PTHREAD_MUTEX_INITIALIZER;
+static xcmDDCCapsEntry_s * xcm_ddc_caps = NULL;
+static char * xcm_ddc_caps_file = NULL;
+static int xcm_ddc_caps_file_loaded = 0;
+
+static int         xcmDDCHexDigit    ( int                 c )
+{
+  if(c >= '0' && c <= '9') return c - '0';
+  if(c >= 'a' && c <= 'f') return c - 'a' + 10;
+  if(c >= 'A' && c <= 'F') return c - 'A' + 10;
+  return -1;
+}
+
+/* @internal
+ * parse the vcp(...) section; with caps == NULL only count */
+static void        xcmDDCCapsParseVCP( const char        * text,
+                                       XcmDDCCaps_s      * caps,
+                                       int               * n_vcp,
+                                       int               * n_values )
+{
+  const char * p = text;
+  int depth = 0, in_vcp = 0, vcp_depth = 0;
+  int vcp = 0, values = 0;
+  XcmDDCCapsVCP_s * current = NULL;
+
+  while(*p)
+  {
+    if(!in_vcp)
+    {
+      if(*p == '(')
+        ++depth;
+      else if(*p == ')')
+        --depth;
+      else if(strncasecmp( p, "vcp", 3 ) == 0 &&
+              (p == text || !isalnum( (unsigned char)p[-1] )))
+      {
+        const char * q = p + 3;
+        while(*q == ' ')
+          ++q;
+        if(*q == '(')
+        {
+          in_vcp = 1;
+          vcp_depth = ++depth;
+          p = q + 1;
+          continue;
+        }
+      }
+      ++p;
+      continue;
+    }
+
+    if(*p == '(')
+      ++depth;
+    else if(*p == ')')
+    {
+      if(--depth < vcp_depth)
+        in_vcp = 0;
+    } else if(xcmDDCHexDigit( p[0] ) >= 0 && xcmDDCHexDigit( p[1] ) >= 0)
+    {
+      unsigned char v = xcmDDCHexDigit( p[0] ) << 4 | xcmDDCHexDigit( p[1] );
+      if(depth == vcp_depth)
+      {
+        if(caps)
+        {
+          current = &caps->vcp[vcp];
+          current->code = v;
+          current->n_values = 0;
+          current->values = (unsigned char*)&caps->vcp[*n_vcp] + values;
+        }
+        ++vcp;
+      } else if(depth == vcp_depth + 1 && vcp)
+      {
+        if(current)
+        {
+          ((unsigned char*)current->values)[current->n_values] = v;
+          ++current->n_values;
+        }
+        ++values;
+      }
+      p += 2;
+      continue;
+    }
+    ++p;
+  }
+
+  if(!caps)
+  {
+    *n_vcp = vcp;
+    *n_values = values;
+  }
+}
+
+/* @internal
+ * build a XcmDDCCaps_s in one allocation */
+static XcmDDCCaps_s * xcmDDCCapsNew  ( const char        * text )
+{
+  XcmDDCCaps_s * caps;
+  int n_vcp = 0, n_values = 0;
+  size_t len = strlen( text );
+  char * mem;
+
+  xcmDDCCapsParseVCP( text, NULL, &n_vcp, &n_values );
+
+  mem = calloc( 1, sizeof(XcmDDCCaps_s) + n_vcp * sizeof(XcmDDCCapsVCP_s) +
+                   n_values + len + 1 );
+  if(!mem)
+    return NULL;
+
+  caps = (XcmDDCCaps_s*) mem;
+  caps->vcp = (XcmDDCCapsVCP_s*)(mem + sizeof(XcmDDCCaps_s));
+  caps->n = n_vcp;
+  caps->text = mem + sizeof(XcmDDCCaps_s) +
+               n_vcp * sizeof(XcmDDCCapsVCP_s) + n_values;
+  memcpy( caps->text, text, len + 1 );
+  xcmDDCCapsParseVCP( caps->text, caps, &n_vcp, &n_values );
+
+  return caps;
+}
+
+/* @internal
+ * call with xcm_ddc_caps_lock held */
+static XcmDDCCaps_s * xcmDDCCapsFind ( uint64_t            hash )
+{
+  xcmDDCCapsEntry_s * e;
+  for(e = xcm_ddc_caps; e; e = e->next)
+    if(e->hash == hash)
+      return e->caps;
+  return NULL;
+}
+
+/* @internal
+ * call with xcm_ddc_caps_lock held */
+static XcmDDCCaps_s * xcmDDCCapsAdd  ( uint64_t            hash,
+                                       const char        * text )
+{
+  xcmDDCCapsEntry_s * e = calloc( 1, sizeof(xcmDDCCapsEntry_s) );
+
+  if(!e)
+    return NULL;
+  e->caps = xcmDDCCapsNew( text );
+  if(!e->caps)
+  {
+    free( e );
+    return NULL;
+  }
+  e->hash = hash;
+  e->next = xcm_ddc_caps;
+  xcm_ddc_caps = e;
+
+  return e->caps;
+}
+
+/* @internal
+ * read the cache file once: lines of "hash capabilities" */
+static void        xcmDDCCapsLoad    ( void )
+{
+  FILE * fp;
+  char * line;
+
+  if(xcm_ddc_caps_file_loaded || !xcm_ddc_caps_file)
+    return;
+  xcm_ddc_caps_file_loaded = 1;
+
+  fp = fopen( xcm_ddc_caps_file, "r" );
+  line = malloc( XCM_DDC_CAPS_MAX + 32 );
+  while(fp && line && fgets( line, XCM_DDC_CAPS_MAX + 32, fp ))
+  {
+    char * text = NULL;
+    unsigned long long hash = strtoull( line, &text, 16 );
+    size_t len;
+
+    if(!text || *text != ' ')
+      continue;
+    ++text;
+    len = strlen( text );
+    while(len && (text[len-1] == '\n' || text[len-1] == '\r'))
+      text[--len] = '\000';
+    if(!xcmDDCCapsFind( hash ))
+      xcmDDCCapsAdd( hash, text );
+  }
+  free( line );
+  if(fp)
+    fclose( fp );
+}
+
+static void        xcmDDCCapsStore   ( uint64_t            hash,
+                                       const char        * text )
+{
+  FILE * fp;
+
+  if(!xcm_ddc_caps_file)
+    return;
+  fp = fopen( xcm_ddc_caps_file, "a" );
+  if(!fp)
+    return;
+  fprintf( fp, "%016llx %s\n", (unsigned long long)hash, text );
+  fclose( fp );
+}
+
+/* @internal
+ * wait for the MCCS delay of the device */
+static void        xcmDDCCIWait      ( XcmDDCDevice_s    * dev )
+{
+  struct timespec ready;
+
+  pthread_mutex_lock( &dev->lock );
+  ready = dev->ci_ready;
+  pthread_mutex_unlock( &dev->lock );
+  clock_nanosleep( CLOCK_MONOTONIC, TIMER_ABSTIME, &ready, NULL );
+}
+
+static void        xcmDDCCIDelay     ( XcmDDCDevice_s    * dev,
+                                       long                us )
+{
+  clock_gettime( CLOCK_MONOTONIC, &dev->ci_ready );
+  xcmDDCTimeAdd( &dev->ci_ready, us );
+}
+
+/* @internal
+ * fetch the capabilities string in 32 byte fragments */
+static XCM_DDC_ERROR_e xcmDDCCapsFetch ( XcmDDCDevice_s  * dev,
+                                       char             ** text )
+{
+  XCM_DDC_ERROR_e error = XCM_DDC_OK;
+  char * caps = calloc( 1, XCM_DDC_CAPS_MAX + 1 );
+  int offset = 0, retries = 0;
+
+  if(!caps)
+    return XCM_DDC_NO_FILE;
+
+  while(offset < XCM_DDC_CAPS_MAX)
+  {
+    unsigned char msg[3], reply[38];
+    int len;
+
+    msg[0] = 0xf3;
+    msg[1] = (offset >> 8) & 0xff;
+    msg[2] = offset & 0xff;
+
+    xcmDDCCIWait( dev );
+    pthread_mutex_lock( &dev->lock );
+    len = xcmDDCCISend( dev, msg, 3 );
+    xcmDDCCIDelay( dev, XCM_DDC_CAPS_DELAY );
+    pthread_mutex_unlock( &dev->lock );
+    if(len != 0)
+    {
+      error = XCM_DDC_PREPARE_FAIL;
+      break;
+    }
+
+    xcmDDCCIWait( dev );
+    pthread_mutex_lock( &dev->lock );
+    len = xcmDDCCIReceive( dev, reply, sizeof(reply) );
+    xcmDDCCIDelay( dev, XCM_DDC_VCP_CMD_DELAY );
+    pthread_mutex_unlock( &dev->lock );
+
+    if(len >= 3 && reply[2] == 0xe3 &&
+       ((reply[3] << 8) | reply[4]) == offset)
+    {
+      len -= 3;
+      if(len == 0)
+        break;
+      if(offset + len > XCM_DDC_CAPS_MAX)
+        len = XCM_DDC_CAPS_MAX - offset;
+      memcpy( &caps[offset], &reply[5], len );
+      offset += len;
+      retries = 0;
+    } else if(++retries >= XCM_DDC_VCP_RETRIES)
+    {
+      error = len < 0 ? -len : XCM_DDC_WRONG_REPLY;
+      break;
+    }
+  }
+
+  if(error == XCM_DDC_OK)
+  {
+    int i;
+    /* keep it on one line for the cache file */
+    for(i = 0; i < offset; ++i)
+      if(caps[i] == '\n' || caps[i] == '\r' || caps[i] == '\000')
+        caps[i] = ' ';
+    caps[offset] = '\000';
+    *text = caps;
+  } else
+    free( caps );
+
+  return error;
+}
+
+/** Function XcmDDCGetCapabilities
+ *  @brief   obtain the MCCS capabilities of a display
+ *
+ *  The capabilities string is fetched in fragments over DDC/CI and parsed
+ *  into a table of VCP codes. The result is cached by the hash of the
+ *  monitor EDID, in memory and in the optional file of
+ *  XcmDDCSetCapabilitiesCache(), so each physical monitor is asked once.
+ *
+ *  @param[in]     dev                 the device handle
+ *  @param[out]    caps                library owned result, valid until
+ *                                     XcmDDCClearCapabilities()
+ *  @return                            error code
+ *
+ *  @version libXcm: 0.5.5
+ *  @since   2026/10/17 (libXcm: 0.5.5)
+ *  @date    2026/10/17
+ */
+XCM_DDC_ERROR_e   XcmDDCGetCapabilities (
+                                       XcmDDCDevice_s    * dev,
+                                       const XcmDDCCaps_s ** caps )
+{
+  XCM_DDC_ERROR_e error;
+  char * edid = NULL, * text = NULL;
+  size_t size = 0;
+  uint64_t hash;
+  const XcmDDCCaps_s * found;
+
+  if(!dev || !caps)
+    return XCM_DDC_NO_FILE;
+  *caps = NULL;
+
+  /* the base block identifies the monitor including its serial */
+  error = xcmDDCgetEDID( dev, 1, NULL, &edid, &size );
+  if(error == XCM_DDC_OK)
+    hash = xcmDDCHash( (unsigned char*)edid, 128 );
+  free( edid );
+  if(error != XCM_DDC_OK)
+    return error;
+
+  pthread_mutex_lock( &xcm_ddc_caps_lock );
+  xcmDDCCapsLoad();
+  found = xcmDDCCapsFind( hash );
+  pthread_mutex_unlock( &xcm_ddc_caps_lock );
+  if(found)
+  {
+    *caps = found;
+    return XCM_DDC_OK;
+  }
+
+  error = xcmDDCCapsFetch( dev, &text );
+  if(error != XCM_DDC_OK)
+    return error;
+
+  pthread_mutex_lock( &xcm_ddc_caps_lock );
+  found = xcmDDCCapsFind( hash );
+  if(!found)
+  {
+    found = xcmDDCCapsAdd( hash, text );
+    if(found)
+      xcmDDCCapsStore( hash, text );
+  }
+  pthread_mutex_unlock( &xcm_ddc_caps_lock );
+  free( text );
+
+  *caps = found;
+  return found ? XCM_DDC_OK : XCM_DDC_NO_FILE;
+}
+
+/** Function XcmDDCSetCapabilitiesCache
+ *  @brief   set a file for caching capabilities across processes
+ *
+ *  @param[in]     file_name           the cache file; NULL disables it
+ *
+ *  @version libXcm: 0.5.5
+ *  @since   2026/10/17 (libXcm: 0.5.5)
+ *  @date    2026/10/17
+ */
+void              XcmDDCSetCapabilitiesCache (
+                                       const char        * file_name )
+{
+  pthread_mutex_lock( &xcm_ddc_caps_lock );
+  free( xcm_ddc_caps_file );
+  xcm_ddc_caps_file = file_name ? strdup( file_name ) : NULL;
+  xcm_ddc_caps_file_loaded = 0;
+  pthread_mutex_unlock( &xcm_ddc_caps_lock );
+}
+
+/** Function XcmDDCClearCapabilities
+ *  @brief   free all cached capabilities in memory
+ *
+ *  @version libXcm: 0.5.5
+ *  @since   2026/10/17 (libXcm: 0.5.5)
+ *  @date    2026/10/17
+ */
+void              XcmDDCClearCapabilities ( void )
+{
+  xcmDDCCapsEntry_s * e, * next;
+
+  pthread_mutex_lock( &xcm_ddc_caps_lock );
+  for(e = xcm_ddc_caps; e; e = next)
+  {
+    next = e->next;
+    free( e->caps );
+    free( e );
+  }
+  xcm_ddc_caps = NULL;
+  xcm_ddc_caps_file_loaded = 0;
+  pthread_mutex_unlock( &xcm_ddc_caps_lock );
 }
 
 
@@ -257,6 +3521,11 @@ const char *   XcmDDCErrorToString   ( XCM_DDC_ERROR_e     error )
   case XCM_DDC_PREPARE_FAIL: text = "Setting EEDID adress failed."; break;
   case XCM_DDC_EDID_READ_FAIL: text = "Could not obtain EEDID."; break;
   case XCM_DDC_WRONG_EDID: text = "Wrong EDID header."; break;
+  case XCM_DDC_PENDING: text = "Transaction not finished."; break;
+  case XCM_DDC_WRONG_REPLY: text = "Unexpected DDC/CI reply."; break;
+  case XCM_DDC_CHECKSUM: text = "DDC/CI checksum mismatch."; break;
+  case XCM_DDC_VCP_UNSUPPORTED: text = "VCP feature not supported."; break;
+  case XCM_DDC_TIMEOUT: text = "Deadline passed."; break;
   }
   return text;
 }
@@ -0,0 +1,416 @@
+/*  @file XcmDDCMock.c
+ *
+ *  libXcm  Xorg Colour Management
+ *
+ *  @par Copyright:
+ *            2026 (C) Kai-Uwe Behrmann
+ *
+ *  @brief    simulated DDC buses serving EDID files
+ *  @internal
+ *  @author   Kai-Uwe Behrmann <ku.b@gmx.de>
+ *  @par License:
+ *            MIT <http://www.opensource.org/licenses/mit-license.php>
+ *  @since    2026/10/17
+ */
+
+#include "XcmVersion.h"
+
+#if XCM_HAVE_LINUX
+
+#include "XcmDDC.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <unistd.h>       /* usleep() */
+#include <dirent.h>       /* opendir() */
+#include <sys/stat.h>     /* stat() */
+#include <time.h>         /* clock_gettime() */
+
+/** \addtogroup XcmDDC
+
+ *  @{
+ *
+ *  XcmDDCTransportMockNew() gives a transport, which serves each file of a
+ *  directory as a i2c bus with a monitor. The file contains the raw EDID.
+ *  A empty file is a bus without monitor. Latency, NAKs, a slow monitor
+ *  and corrupted reads are simulated as configured. An adapter, which announces more
+ *  than it performs, exercises the transfer mode fallback. DDC/CI
+ *  messages are not answered.
+ *  Install it with XcmDDCSetTransport().
+ *
+ */
+
+typedef struct {
+  XcmDDCTransport_s  transport;        /* must stay the first member */
+  char             * dir;
+  XcmDDCMockOptions_s options;
+} xcmDDCMock_s;
+
+typedef struct {
+  xcmDDCMock_s     * mock;
+  unsigned char    * data;             /* EDID, NULL for a empty bus */
+  size_t             size;
+  int                slave;
+  int                segment;          /* E-DDC segment pointer */
+  int                offset;           /* word offset */
+  uint32_t           random;           /* xorshift state */
+  struct timespec    last;             /* open or the last access */
+} xcmDDCMockBus_s;
+
+static uint32_t    xcmDDCMockRandom  ( xcmDDCMockBus_s   * bus )
+{
+  uint32_t x = bus->random;
+  x ^= x << 13;
+  x ^= x >> 17;
+  x ^= x << 5;
+  bus->random = x;
+  return x;
+}
+
+/* @internal
+ * account the latency of one transfer */
+static void        xcmDDCMockLatency ( xcmDDCMockBus_s   * bus )
+{
+  if(bus->mock->options.latency_us > 0)
+    usleep( bus->mock->options.latency_us );
+}
+
+/* @internal
+ * decide about a NAK of a message */
+static int         xcmDDCMockAccess  ( xcmDDCMockBus_s   * bus,
+                                       int                 address )
+{
+  const XcmDDCMockOptions_s * options = &bus->mock->options;
+
+  if(!bus->data || (address != 0x30 && address != 0x50))
+    return -1;
+  if(options->settle_us > 0)
+  {
+    /* a slow monitor misses accesses, which follow too fast */
+    struct timespec now;
+    long long us;
+    clock_gettime( CLOCK_MONOTONIC, &now );
+    us = (long long)(now.tv_sec - bus->last.tv_sec) * 1000000 +
+         (now.tv_nsec - bus->last.tv_nsec) / 1000;
+    bus->last = now;
+    if(us < options->settle_us)
+      return -1;
+  }
+  if(options->nak_percent > 0 &&
+     (int)(xcmDDCMockRandom( bus ) % 100) < options->nak_percent)
+    return -1;
+
+  return 0;
+}
+
+static void        xcmDDCMockCopy    ( xcmDDCMockBus_s   * bus,
+                                       unsigned char     * buf,
+                                       int                 len )
+{
+  const XcmDDCMockOptions_s * options = &bus->mock->options;
+  int i;
+
+  for(i = 0; i < len; ++i)
+  {
+    size_t pos = (size_t)bus->segment * 256 + ((bus->offset + i) & 0xff);
+    buf[i] = pos < bus->size ? bus->data[pos] : 0xff;
+  }
+  bus->offset = (bus->offset + len) & 0xff;
+
+  if(len && options->corrupt_percent > 0 &&
+     (int)(xcmDDCMockRandom( bus ) % 100) < options->corrupt_percent)
+    buf[xcmDDCMockRandom( bus ) % len] ^= 1 << (xcmDDCMockRandom( bus ) % 8);
+}
+
+static int         xcmDDCMockList    ( void              * user,
+                                       char            *** devices,
+                                       int               * count )
+{
+  xcmDDCMock_s * mock = user;
+  DIR * dir = opendir( mock->dir );
+  struct dirent * entry;
+  char ** list = NULL;
+  int n = 0, size = 0;
+
+  *devices = NULL;
+  *count = 0;
+  if(!dir)
+    return -1;
+
+  while((entry = readdir( dir )) != NULL)
+  {
+    struct stat st;
+    char * name;
+
+    if(entry->d_name[0] == '.')
+      continue;
+
+    name = malloc( strlen( mock->dir ) + strlen( entry->d_name ) + 2 );
+    if(!name)
+      break;
+    sprintf( name, "%s/%s", mock->dir, entry->d_name );
+    if(stat( name, &st ) != 0 || !S_ISREG( st.st_mode ))
+    {
+      free( name );
+      continue;
+    }
+
+    if(n == size)
+    {
+      char ** l;
+      size = size ? size * 2 : 32;
+      l = realloc( list, size * sizeof(char*) );
+      if(!l)
+      {
+        free( name );
+        break;
+      }
+      list = l;
+    }
+    list[n++] = name;
+  }
+  closedir( dir );
+
+  *devices = list;
+  *count = n;
+  return 0;
+}
+
+static void *      xcmDDCMockOpen    ( void              * user,
+                                       const char        * device,
+                                       unsigned long     * funcs )
+{
+  xcmDDCMock_s * mock = user;
+  xcmDDCMockBus_s * bus;
+  FILE * fp = fopen( device, "rb" );
+  long size = 0;
+  uint32_t hash = 2166136261u;
+  const char * c;
+
+  if(!fp)
+    return NULL;
+  bus = calloc( 1, sizeof(xcmDDCMockBus_s) );
+  if(!bus)
+  {
+    fclose( fp );
+    return NULL;
+  }
+
+  if(fseek( fp, 0, SEEK_END ) == 0)
+    size = ftell( fp );
+  rewind( fp );
+  if(size > 0)
+  {
+    bus->data = malloc( size );
+    if(bus->data && fread( bus->data, 1, size, fp ) == (size_t)size)
+      bus->size = size;
+    else
+    {
+      free( bus->data );
+      bus->data = NULL;
+    }
+  }
+  fclose( fp );
+
+  for(c = device; *c; ++c)
+    hash = (hash ^ (unsigned char)*c) * 16777619u;
+  bus->random = (mock->options.seed ^ hash) | 1;
+  bus->mock = mock;
+  bus->slave = -1;
+  clock_gettime( CLOCK_MONOTONIC, &bus->last );
+
+  /* a adapter may announce transfers, which it rejects later */
+  if(mock->options.announce)
+    *funcs = mock->options.announce;
+  else
+    *funcs = mock->options.funcs ? mock->options.funcs :
+             XCM_DDC_FUNC_I2C | XCM_DDC_FUNC_SMBUS_READ_BLOCK;
+
+  return bus;
+}
+
+static void        xcmDDCMockClose   ( void              * handle )
+{
+  xcmDDCMockBus_s * bus = handle;
+  free( bus->data );
+  free( bus );
+}
+
+static int         xcmDDCMockAddress ( void              * handle,
+                                       int                 address,
+                                       int                 force )
+{
+  xcmDDCMockBus_s * bus = handle;
+  (void)force;
+  /* selecting a slave puts nothing on the bus */
+  bus->slave = address;
+  return 0;
+}
+
+static int         xcmDDCMockTransfer( void              * handle,
+                                       XcmDDCMsg_s       * msgs,
+                                       int                 n )
+{
+  xcmDDCMockBus_s * bus = handle;
+  int i, error = 0;
+
+  if(!(bus->mock->options.funcs == 0 ||
+       bus->mock->options.funcs & XCM_DDC_FUNC_I2C))
+    return -1;
+
+  xcmDDCMockLatency( bus );
+  for(i = 0; i < n && !error; ++i)
+  {
+    error = xcmDDCMockAccess( bus, msgs[i].addr );
+    if(error)
+      break;
+    if(msgs[i].read)
+    {
+      if(msgs[i].addr != 0x50)
+        error = -1;
+      else
+        xcmDDCMockCopy( bus, msgs[i].buf, msgs[i].len );
+    } else if(msgs[i].len >= 1)
+    {
+      if(msgs[i].addr == 0x30)
+        bus->segment = msgs[i].buf[0];
+      else
+        bus->offset = msgs[i].buf[0];
+    }
+  }
+  /* the segment pointer resets with the stop condition */
+  bus->segment = 0;
+
+  return error;
+}
+
+static int         xcmDDCMockSMBusRead(void              * handle,
+                                       int                 command,
+                                       unsigned char     * buf,
+                                       int                 len )
+{
+  xcmDDCMockBus_s * bus = handle;
+
+  if(!(bus->mock->options.funcs == 0 ||
+       bus->mock->options.funcs & XCM_DDC_FUNC_SMBUS_READ_BLOCK))
+    return -1;
+  xcmDDCMockLatency( bus );
+  if(xcmDDCMockAccess( bus, bus->slave ) != 0)
+    return -1;
+
+  bus->offset = command & 0xff;
+  xcmDDCMockCopy( bus, buf, len );
+
+  return 0;
+}
+
+static int         xcmDDCMockWrite   ( void              * handle,
+                                       const unsigned char * buf,
+                                       int                 len )
+{
+  xcmDDCMockBus_s * bus = handle;
+
+  xcmDDCMockLatency( bus );
+  if(xcmDDCMockAccess( bus, bus->slave ) != 0)
+    return -1;
+  if(len >= 1 && bus->slave == 0x50)
+    bus->offset = buf[0];
+
+  return len;
+}
+
+static int         xcmDDCMockRead    ( void              * handle,
+                                       unsigned char     * buf,
+                                       int                 len )
+{
+  xcmDDCMockBus_s * bus = handle;
+
+  xcmDDCMockLatency( bus );
+  if(xcmDDCMockAccess( bus, bus->slave ) != 0 || bus->slave != 0x50)
+    return -1;
+  xcmDDCMockCopy( bus, buf, len );
+
+  return len;
+}
+
+/** Function XcmDDCTransportMockNew
+ *  @brief   create a simulated transport
+ *
+ *  Each regular file in directory is a bus. XcmDDClist() returns the file
+ *  paths as device names.
+ *
+ *  @param[in]     directory           directory with EDID files
+ *  @param[in]     options             optional; latency and error rates
+ *  @return                            the transport, release with
+ *                                     XcmDDCTransportMockFree()
+ *
+ *  @version libXcm: 0.5.5
+ *  @since   2026/10/17 (libXcm: 0.5.5)
+ *  @date    2026/10/17
+ */
+XcmDDCTransport_s * XcmDDCTransportMockNew (
+                                       const char        * directory,
+                                       const XcmDDCMockOptions_s * options )
+{
+  xcmDDCMock_s * mock;
+
+  if(!directory)
+    return NULL;
+
+  mock = calloc( 1, sizeof(xcmDDCMock_s) );
+  if(!mock)
+    return NULL;
+  mock->dir = strdup( directory );
+  if(!mock->dir)
+  {
+    free( mock );
+    return NULL;
+  }
+  if(options)
+    mock->options = *options;
+
+  mock->transport.name = "mock";
+  mock->transport.user = mock;
+  mock->transport.list = xcmDDCMockList;
+  mock->transport.open = xcmDDCMockOpen;
+  mock->transport.close = xcmDDCMockClose;
+  mock->transport.address = xcmDDCMockAddress;
+  mock->transport.transfer = xcmDDCMockTransfer;
+  mock->transport.smbus_read = xcmDDCMockSMBusRead;
+  mock->transport.write = xcmDDCMockWrite;
+  mock->transport.read = xcmDDCMockRead;
+
+  return &mock->transport;
+}
+
+/** Function XcmDDCTransportMockFree
+ *  @brief   release a simulated transport
+ *
+ *  Release all devices of the transport before, e.g. with
+ *  XcmDDCSetTransport( NULL ) and XcmDDCPoolClear().
+ *
+ *  @param[in,out] transport           the transport; is set to NULL
+ *
+ *  @version libXcm: 0.5.5
+ *  @since   2026/10/17 (libXcm: 0.5.5)
+ *  @date    2026/10/17
+ */
+void               XcmDDCTransportMockFree (
+                                       XcmDDCTransport_s ** transport )
+{
+  xcmDDCMock_s * mock;
+
+  if(!transport || !*transport)
+    return;
+
+  mock = (xcmDDCMock_s*) *transport;
+  free( mock->dir );
+  free( mock );
+  *transport = NULL;
+}
+
+/** @} XcmDDC */
+
+#endif /* Linux */
@@ -0,0 +1,563 @@
+/*  @file XcmEdidDb.c
+ *
+ *  libXcm  Xorg Colour Management
+ *
+ *  @par Copyright:
+ *            2026 (C) Kai-Uwe Behrmann
+ *
+ *  @brief    binary data base of parsed EDID blocks
+ *  @internal
+ *  @author   Kai-Uwe Behrmann <ku.b@gmx.de>
+ *  @par License:
+ *            MIT <http://www.opensource.org/licenses/mit-license.php>
+ *  @since    2026/10/17
+ */
+
+#include "XcmEdidDb.h"
+#include "XcmVersion.h"
+
+#include <string.h>
+#include <stdlib.h>
+#include <stdio.h>
+
+#if defined(XCM_HAVE_LINUX)
+#include <fcntl.h>        /* open() */
+#include <unistd.h>       /* close() */
+#include <sys/mman.h>     /* mmap() */
+#include <sys/stat.h>     /* fstat() */
+#endif
+
+/** \addtogroup XcmEdidParse
+
+ *  @{
+ *
+ *  A XcmEdidDb file stores many XcmEdidInfo_s results as fixed size
+ *  XcmEdidRecord_s entries with a shared string table. XcmEdidDbWriter_New(),
+ *  XcmEdidDbWriter_Add() and XcmEdidDbWriter_Save() create such a file.
+ *  XcmEdidDb_Open() maps it into memory; XcmEdidDb_Get() then gives random
+ *  access to records without any deserialisation.
+ */
+
+struct XcmEdidDbWriter_s_ {
+  XcmEdidRecord_s * records;
+  size_t            count;
+  size_t            records_size;
+  char            * strings;
+  size_t            strings_len;
+  size_t            strings_size;
+  uint32_t        * hash;              /* string offset + 1, 0 for empty */
+  size_t            hash_size;
+  size_t            hash_count;
+};
+
+struct XcmEdidDb_s_ {
+  const unsigned char * data;
+  size_t                size;
+  int                   mapped;
+  const XcmEdidDbHeader_s * header;
+  const XcmEdidRecord_s   * records;
+  const char            * strings;
+};
+
+static uint32_t     XcmEdidDbHash    ( const char        * text )
+{
+  uint32_t h = 2166136261u;
+  while(*text)
+    h = (h ^ (unsigned char)*text++) * 16777619u;
+  return h;
+}
+
+static int          XcmEdidDbGrow    ( void             ** ptr,
+                                       size_t            * size,
+                                       size_t              need,
+                                       size_t              elem )
+{
+  size_t n = *size ? *size : 256;
+  void * p;
+
+  if(need <= *size)
+    return 0;
+  while(n < need)
+    n *= 2;
+  p = realloc( *ptr, n * elem );
+  if(!p)
+    return 1;
+  *ptr = p;
+  *size = n;
+  return 0;
+}
+
+/* @internal
+ * add text to the string table once and return its offset */
+static int          XcmEdidDbString  ( XcmEdidDbWriter_s * w,
+                                       const char        * text,
+                                       uint32_t          * offset )
+{
+  size_t len = strlen( text ), i;
+  uint32_t h;
+
+  if(!len)
+  {
+    *offset = 0;
+    return 0;
+  }
+
+  /* keep the hash table at most half full */
+  if((w->hash_count + 1) * 2 > w->hash_size)
+  {
+    size_t n = w->hash_size ? w->hash_size * 2 : 1024;
+    uint32_t * hash = calloc( n, sizeof(uint32_t) );
+
+    if(!hash)
+      return 1;
+    for(i = 0; i < w->hash_size; ++i)
+      if(w->hash[i])
+      {
+        size_t j = XcmEdidDbHash( &w->strings[w->hash[i] - 1] ) & (n - 1);
+        while(hash[j])
+          j = (j + 1) & (n - 1);
+        hash[j] = w->hash[i];
+      }
+    free( w->hash );
+    w->hash = hash;
+    w->hash_size = n;
+  }
+
+  h = XcmEdidDbHash( text );
+  for(i = h & (w->hash_size - 1); w->hash[i]; i = (i + 1) & (w->hash_size - 1))
+    if(strcmp( &w->strings[w->hash[i] - 1], text ) == 0)
+    {
+      *offset = w->hash[i] - 1;
+      return 0;
+    }
+
+  if(w->strings_len + len + 1 > UINT32_MAX ||
+     XcmEdidDbGrow( (void**)&w->strings, &w->strings_size,
+                    w->strings_len + len + 1, 1 ))
+    return 1;
+
+  *offset = (uint32_t) w->strings_len;
+  memcpy( &w->strings[w->strings_len], text, len + 1 );
+  w->strings_len += len + 1;
+  w->hash[i] = *offset + 1;
+  ++w->hash_count;
+
+  return 0;
+}
+
+/** Function XcmEdidDbWriter_New
+ *  @brief   create a writer for a XcmEdidDb file
+ *
+ *  @return                            the writer or NULL
+ *
+ *  @version libXcm: 0.5.5
+ *  @since   2026/10/17 (libXcm: 0.5.5)
+ *  @date    2026/10/17
+ */
+XcmEdidDbWriter_s * XcmEdidDbWriter_New ( void )
+{
+  XcmEdidDbWriter_s * w = calloc( 1, sizeof(XcmEdidDbWriter_s) );
+
+  /* offset 0 is the empty string */
+  if(w && XcmEdidDbGrow( (void**)&w->strings, &w->strings_size, 1, 1 ) == 0)
+  {
+    w->strings[0] = '\000';
+    w->strings_len = 1;
+  } else if(w)
+  {
+    free( w );
+    w = NULL;
+  }
+
+  return w;
+}
+
+/** Function XcmEdidDbWriter_Add
+ *  @brief   append a parsed EDID
+ *
+ *  @param[in,out] w                   the writer
+ *  @param[in]     info                a XcmEdidParseInto() result
+ *  @return                            error code
+ *
+ *  @version libXcm: 0.5.5
+ *  @since   2026/10/17 (libXcm: 0.5.5)
+ *  @date    2026/10/17
+ */
+XCM_EDID_ERROR_e  XcmEdidDbWriter_Add( XcmEdidDbWriter_s * w,
+                                       const XcmEdidInfo_s * info )
+{
+  XcmEdidRecord_s * r;
+
+  if(!w || !info)
+    return XCM_EDID_WRONG_ARGUMENT;
+
+  if(XcmEdidDbGrow( (void**)&w->records, &w->records_size, w->count + 1,
+                    sizeof(XcmEdidRecord_s) ))
+    return XCM_EDID_NO_MEMORY;
+
+  r = &w->records[w->count];
+  memset( r, 0, sizeof(XcmEdidRecord_s) );
+
+  if(XcmEdidDbString( w, info->vendor, &r->vendor ) ||
+     XcmEdidDbString( w, info->model, &r->model ) ||
+     XcmEdidDbString( w, info->serial, &r->serial ) ||
+     XcmEdidDbString( w, info->mnft, &r->mnft ) ||
+     XcmEdidDbString( w, info->manufacturer, &r->manufacturer ))
+    return XCM_EDID_NO_MEMORY;
+
+  r->flags = info->flags;
+  r->mnft_id = info->mnft_id;
+  r->model_id = info->model_id;
+  r->week = info->week;
+  r->year = info->year;
+  r->extensions = info->extensions;
+  r->eotf = info->eotf;
+  r->colorimetry = info->colorimetry;
+  r->video_capability = info->video_capability;
+  r->red_x = info->red_x;
+  r->red_y = info->red_y;
+  r->green_x = info->green_x;
+  r->green_y = info->green_y;
+  r->blue_x = info->blue_x;
+  r->blue_y = info->blue_y;
+  r->white_x = info->white_x;
+  r->white_y = info->white_y;
+  r->gamma = info->gamma;
+  r->a3red = info->a3red;
+  r->a2red = info->a2red;
+  r->a3green = info->a3green;
+  r->a2green = info->a2green;
+  r->a3blue = info->a3blue;
+  r->a2blue = info->a2blue;
+  r->max_luminance = info->max_luminance;
+  r->max_frame_avg_luminance = info->max_frame_avg_luminance;
+  r->min_luminance = info->min_luminance;
+
+  ++w->count;
+
+  return XCM_EDID_OK;
+}
+
+/** Function XcmEdidDbWriter_Save
+ *  @brief   write all added records to a file
+ *
+ *  @param[in]     w                   the writer
+ *  @param[in]     file_name           the file to create or replace
+ *  @return                            error code
+ *
+ *  @version libXcm: 0.5.5
+ *  @since   2026/10/17 (libXcm: 0.5.5)
+ *  @date    2026/10/17
+ */
+XCM_EDID_ERROR_e  XcmEdidDbWriter_Save(XcmEdidDbWriter_s * w,
+                                       const char        * file_name )
+{
+  XcmEdidDbHeader_s header;
+  FILE * fp;
+  int error = 0;
+
+  if(!w || !file_name)
+    return XCM_EDID_WRONG_ARGUMENT;
+
+  memset( &header, 0, sizeof(header) );
+  memcpy( header.magic, XCM_EDID_DB_MAGIC, sizeof(header.magic) );
+  header.version = XCM_EDID_DB_VERSION;
+  header.byte_order = XCM_EDID_DB_BYTE_ORDER;
+  header.header_size = sizeof(XcmEdidDbHeader_s);
+  header.record_size = sizeof(XcmEdidRecord_s);
+  header.count = w->count;
+  header.records_offset = sizeof(XcmEdidDbHeader_s);
+  header.strings_offset = header.records_offset +
+                          (uint64_t)w->count * sizeof(XcmEdidRecord_s);
+  header.strings_size = w->strings_len;
+
+  fp = fopen( file_name, "wb" );
+  if(!fp)
+    return XCM_EDID_FILE_FAIL;
+
+  if(fwrite( &header, sizeof(header), 1, fp ) != 1)
+    error = 1;
+  if(!error && w->count &&
+     fwrite( w->records, sizeof(XcmEdidRecord_s), w->count, fp ) != w->count)
+    error = 1;
+  if(!error &&
+     fwrite( w->strings, 1, w->strings_len, fp ) != w->strings_len)
+    error = 1;
+  if(fclose( fp ))
+    error = 1;
+
+  return error ? XCM_EDID_FILE_FAIL : XCM_EDID_OK;
+}
+
+/** Function XcmEdidDbWriter_Release
+ *  @brief   free the writer
+ *
+ *  @param[in,out] w                   the writer; is set to NULL
+ *
+ *  @version libXcm: 0.5.5
+ *  @since   2026/10/17 (libXcm: 0.5.5)
+ *  @date    2026/10/17
+ */
+void              XcmEdidDbWriter_Release (
+                                       XcmEdidDbWriter_s** w )
+{
+  if(!w || !*w)
+    return;
+
+  free( (*w)->records );
+  free( (*w)->strings );
+  free( (*w)->hash );
+  free( *w );
+  *w = NULL;
+}
+
+/** Function XcmEdidDb_Open
+ *  @brief   map a XcmEdidDb file
+ *
+ *  The file is mapped read only, where mmap() is available, and read
+ *  into memory otherwise. The header is verified for magic, version,
+ *  byte order and bounds.
+ *
+ *  @param[in]     file_name           the XcmEdidDb file
+ *  @param[out]    db                  the opened data base
+ *  @return                            error code
+ *
+ *  @version libXcm: 0.5.5
+ *  @since   2026/10/17 (libXcm: 0.5.5)
+ *  @date    2026/10/17
+ */
+XCM_EDID_ERROR_e  XcmEdidDb_Open     ( const char        * file_name,
+                                       XcmEdidDb_s      ** db )
+{
+  XcmEdidDb_s * d;
+  const XcmEdidDbHeader_s * h;
+
+  if(!file_name || !db)
+    return XCM_EDID_WRONG_ARGUMENT;
+  *db = NULL;
+
+  d = calloc( 1, sizeof(XcmEdidDb_s) );
+  if(!d)
+    return XCM_EDID_NO_MEMORY;
+
+#if defined(XCM_HAVE_LINUX)
+  {
+    struct stat st;
+    int fd = open( file_name, O_RDONLY );
+    void * data;
+
+    if(fd == -1 || fstat( fd, &st ) != 0 || st.st_size <= 0)
+    {
+      if(fd != -1)
+        close( fd );
+      free( d );
+      return XCM_EDID_FILE_FAIL;
+    }
+
+    data = mmap( NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0 );
+    close( fd );
+    if(data == MAP_FAILED)
+    {
+      free( d );
+      return XCM_EDID_FILE_FAIL;
+    }
+    d->data = data;
+    d->size = st.st_size;
+    d->mapped = 1;
+  }
+#else
+  {
+    FILE * fp = fopen( file_name, "rb" );
+    long size = 0;
+    void * data = NULL;
+
+    if(fp && fseek( fp, 0L, SEEK_END ) == 0)
+      size = ftell( fp );
+    if(size > 0)
+      data = malloc( size );
+    if(data)
+    {
+      rewind( fp );
+      if(fread( data, 1, size, fp ) != (size_t)size)
+      {
+        free( data );
+        data = NULL;
+      }
+    }
+    if(fp)
+      fclose( fp );
+    if(!data)
+    {
+      free( d );
+      return XCM_EDID_FILE_FAIL;
+    }
+    d->data = data;
+    d->size = size;
+  }
+#endif
+
+  h = (const XcmEdidDbHeader_s*) d->data;
+  if(d->size < sizeof(XcmEdidDbHeader_s) ||
+     memcmp( h->magic, XCM_EDID_DB_MAGIC, sizeof(h->magic) ) != 0 ||
+     h->version != XCM_EDID_DB_VERSION ||
+     h->byte_order != XCM_EDID_DB_BYTE_ORDER ||
+     h->header_size != sizeof(XcmEdidDbHeader_s) ||
+     h->record_size != sizeof(XcmEdidRecord_s) ||
+     h->records_offset % 8 ||
+     h->records_offset > d->size ||
+     h->count > (d->size - h->records_offset) / sizeof(XcmEdidRecord_s) ||
+     h->strings_offset > d->size ||
+     h->strings_size == 0 ||
+     h->strings_size > d->size - h->strings_offset ||
+     d->data[h->strings_offset + h->strings_size - 1] != '\000')
+  {
+    XcmEdidDb_Release( &d );
+    return XCM_EDID_WRONG_SIGNATURE;
+  }
+
+  d->header = h;
+  d->records = (const XcmEdidRecord_s*)(d->data + h->records_offset);
+  d->strings = (const char*)(d->data + h->strings_offset);
+  *db = d;
+
+  return XCM_EDID_OK;
+}
+
+/** Function XcmEdidDb_Count
+ *  @brief   number of records
+ *
+ *  @version libXcm: 0.5.5
+ *  @since   2026/10/17 (libXcm: 0.5.5)
+ *  @date    2026/10/17
+ */
+size_t            XcmEdidDb_Count    ( const XcmEdidDb_s * db )
+{
+  return db ? (size_t) db->header->count : 0;
+}
+
+/** Function XcmEdidDb_Get
+ *  @brief   access a record in place
+ *
+ *  @param[in]     db                  the data base
+ *  @param[in]     pos                 record number
+ *  @return                            the mapped record or NULL
+ *
+ *  @version libXcm: 0.5.5
+ *  @since   2026/10/17 (libXcm: 0.5.5)
+ *  @date    2026/10/17
+ */
+const XcmEdidRecord_s * XcmEdidDb_Get( const XcmEdidDb_s * db,
+                                       size_t              pos )
+{
+  if(!db || pos >= db->header->count)
+    return NULL;
+  return &db->records[pos];
+}
+
+/** Function XcmEdidDb_String
+ *  @brief   resolve a record text field
+ *
+ *  @param[in]     db                  the data base
+ *  @param[in]     offset              a XcmEdidRecord_s text field
+ *  @return                            the mapped text; "" for invalid offsets
+ *
+ *  @version libXcm: 0.5.5
+ *  @since   2026/10/17 (libXcm: 0.5.5)
+ *  @date    2026/10/17
+ */
+const char *      XcmEdidDb_String   ( const XcmEdidDb_s * db,
+                                       uint32_t            offset )
+{
+  if(!db || offset >= db->header->strings_size)
+    return "";
+  return &db->strings[offset];
+}
+
+/** Function XcmEdidDb_GetInfo
+ *  @brief   copy a record into a XcmEdidInfo_s
+ *
+ *  @param[in]     db                  the data base
+ *  @param[in]     pos                 record number
+ *  @param[out]    out                 the record values
+ *  @return                            error code
+ *
+ *  @version libXcm: 0.5.5
+ *  @since   2026/10/17 (libXcm: 0.5.5)
+ *  @date    2026/10/17
+ */
+XCM_EDID_ERROR_e  XcmEdidDb_GetInfo  ( const XcmEdidDb_s * db,
+                                       size_t              pos,
+                                       XcmEdidInfo_s     * out )
+{
+  const XcmEdidRecord_s * r = XcmEdidDb_Get( db, pos );
+
+  if(!r || !out)
+    return XCM_EDID_WRONG_ARGUMENT;
+
+  memset( out, 0, sizeof(XcmEdidInfo_s) );
+#define XCM_DB_TEXT(key) \
+  snprintf( out->key, sizeof(out->key), "%s", XcmEdidDb_String( db, r->key ) );
+  XCM_DB_TEXT( vendor )
+  XCM_DB_TEXT( model )
+  XCM_DB_TEXT( serial )
+  XCM_DB_TEXT( mnft )
+  XCM_DB_TEXT( manufacturer )
+#undef XCM_DB_TEXT
+
+  out->flags = r->flags;
+  out->mnft_id = r->mnft_id;
+  out->model_id = r->model_id;
+  out->week = r->week;
+  out->year = r->year;
+  out->extensions = r->extensions;
+  out->eotf = r->eotf;
+  out->colorimetry = r->colorimetry;
+  out->video_capability = r->video_capability;
+  out->red_x = r->red_x;
+  out->red_y = r->red_y;
+  out->green_x = r->green_x;
+  out->green_y = r->green_y;
+  out->blue_x = r->blue_x;
+  out->blue_y = r->blue_y;
+  out->white_x = r->white_x;
+  out->white_y = r->white_y;
+  out->gamma = r->gamma;
+  out->a3red = r->a3red;
+  out->a2red = r->a2red;
+  out->a3green = r->a3green;
+  out->a2green = r->a2green;
+  out->a3blue = r->a3blue;
+  out->a2blue = r->a2blue;
+  out->max_luminance = r->max_luminance;
+  out->max_frame_avg_luminance = r->max_frame_avg_luminance;
+  out->min_luminance = r->min_luminance;
+
+  return XCM_EDID_OK;
+}
+
+/** Function XcmEdidDb_Release
+ *  @brief   unmap the data base
+ *
+ *  @param[in,out] db                  the data base; is set to NULL
+ *
+ *  @version libXcm: 0.5.5
+ *  @since   2026/10/17 (libXcm: 0.5.5)
+ *  @date    2026/10/17
+ */
+void              XcmEdidDb_Release  ( XcmEdidDb_s      ** db )
+{
+  if(!db || !*db)
+    return;
+
+#if defined(XCM_HAVE_LINUX)
+  if((*db)->mapped)
+    munmap( (void*)(*db)->data, (*db)->size );
+  else
+#endif
+    free( (void*)(*db)->data );
+
+  free( *db );
+  *db = NULL;
+}
+
+/** @} XcmEdidParse */
@@ -15,12 +15,24 @@
  */
 
 #include "XcmEdidParse.h"
+#include "XcmVersion.h"
+#if defined(XCM_HAVE_PNP_IDS_FULL)
+#include "XcmPnpIdsFull.h"   /* generated from the system pnp.ids */
+#else
+#include "XcmPnpIds.h"
+#endif
 
 #include <math.h>
 #include <string.h>
 #include <stdlib.h>
 #include <stdio.h>
 #include <stdint.h>
+#include <stdarg.h>
+
+#if defined(XCM_HAVE_LINUX)
+#include <pthread.h>
+#include <unistd.h>       /* sysconf() */
+#endif
 
 /** \addtogroup XcmEdidParse X Color Management EDID data block parsing API's
 
@@ -37,15 +49,39 @@
  *  with some first rough interpretation. The key/values are useable for 
  *  data bases, ICC profile generation or device identification.
  *  The returned XcmEdidKeyValue_s list elements can be individually read and
- *  worked with. Please look as well on the XcmEdidPrintString() function
- *  and examples/edid-parse/ as a small example on how to use the API.
+ *  worked with. XcmEdidGet() finds an element by its XCM_EDID_ID_e.
+ *  Please look as well on the XcmEdidPrintString() function and
+ *  examples/edid-parse/ as a small example on how to use the API.
  *  The XcmEdidPrintOpenIccJSON() will pull out a JSON data structure.
+ *  XcmEdidWriteString() and XcmEdidWriteOpenIccJSON() stream the same
+ *  text to a callback, like XcmEdidWriteFILE().
  *  XcmEdidFree() releases allocated list memory.
  *
+ *  XcmEdidParseInto() fills a caller owned XcmEdidInfo_s structure and
+ *  needs no memory management at all. This is the preferred way for
+ *  frequent parsing, e.g. on each hotplug event.
+ *  XcmEdidParseBatch() and XcmEdidParseBlocks() do the same for many
+ *  EDIDs at once and can spread the work over several threads.
+ *  XcmEdidDecodeChromaticity() converts only the colour characteristics of
+ *  many EDIDs.
+ *
  */
 
 static int
 decode_color_characteristics (const unsigned char *edid, double * c);
+static int          XcmEdidParseDisplayID (
+                                       const unsigned char * section,
+                                       size_t              size,
+                                       int                 standalone,
+                                       XcmEdidInfo_s     * out,
+                                       double            * luminance );
+static void         XcmEdidApplyDisplayIDLuminance (
+                                       XcmEdidInfo_s     * out,
+                                       const double      * luminance );
+static void         XcmEdidParseExtensions (
+                                       const unsigned char * edid,
+                                       size_t              size,
+                                       XcmEdidInfo_s     * out );
 
 static int          XcmBigEndian()
 {
@@ -147,55 +183,85 @@ static void         XcmEdidSetText   ( XcmEdidKeyValue_s * entry,
   entry->value.text = XcmCheckText( value );
 }
 
-#define SET_INT(key)  if(key) \
-    XcmEdidSetInt( &(*list)[pos++], #key, key );
-#define SET_DBL(key)  if(key) \
-    XcmEdidSetDouble( &(*list)[pos++], #key, key );
-#define SET_TXT(key)  if(key) \
-    XcmEdidSetText( &(*list)[pos++], #key, key );
+#define SET_SLOT(id)  l->slot[XCM_EDID_ID_##id] = pos;
+#define SET_INT(key, id)  if(info->key) { SET_SLOT(id) \
+    XcmEdidSetInt( &(*list)[pos++], #key, info->key ); }
+#define SET_DBL(key, id)  { SET_SLOT(id) \
+    XcmEdidSetDouble( &(*list)[pos++], #key, info->key ); }
+#define SET_TXT(key, id)  { SET_SLOT(id) \
+    XcmEdidSetText( &(*list)[pos++], #key, info->key ); }
+
+/* @internal
+ * single allocation behind a XcmEdidParse() list; slot maps a
+ * XCM_EDID_ID_e to a list position or -1 */
+typedef struct {
+  XcmEdidInfo_s       info;
+  signed char         slot[XCM_EDID_ID_COUNT];
+  XcmEdidKeyValue_s   list[31];
+} XcmEdidList_s;
+
+#define XcmEdidListFromKeyValue(l) \
+  ((XcmEdidList_s*)((char*)(l) - offsetof(XcmEdidList_s, list)))
 
 /* basic access functions */
 
-/** Function XcmEdidParse
- *  @brief   EDID to key/value pair transformation
+/** Function XcmEdidParseInto
+ *  @brief   EDID to fixed structure transformation
  *
- *  The function performs no verification of the data block other than the
- *  first eight byte block signature.
+ *  The function writes all fields, text included, into the caller owned
+ *  structure and does no heap allocation. It performs no verification of
+ *  the data block other than the first eight byte block signature.
+ *  CEA-861 extension blocks are parsed for HDR static metadata,
+ *  colorimetry and video capability data blocks, as far as size covers
+ *  the announced extensions. DisplayID 2.0 display parameters, either from
+ *  a extension block or from a standalone DisplayID structure in edid,
+ *  take precedence for the primaries, gamma and the luminance values they
+ *  set, independent of the block order.
  *
- *  @param[in]     edid                EDID data block 128 or 256 bytes long
- *  @param[out]    list                the key/value data structures
- *  @param[in,out] count               pass in a pointer to a int. gives the 
- *                                     number of elements in list
+ *  @param[in]     edid                EDID or DisplayID data block
+ *  @param[in]     size                size of edid; at least 128 bytes for
+ *                                     EDID
+ *  @param[out]    out                 the parsed values
  *  @return                            error code
  *
- *  @version libXcm: 0.3.0
- *  @since   2009/12/12 (libXcm: 0.3.0)
- *  @date    2010/10/01
+ *  @version libXcm: 0.5.5
+ *  @since   2026/10/17 (libXcm: 0.5.5)
+ *  @date    2026/10/17
  */
-XCM_EDID_ERROR_e  XcmEdidParse       ( void              * edid,
-                                       XcmEdidKeyValue_s** list,
-                                       int               * count )
+XCM_EDID_ERROR_e  XcmEdidParseInto   ( const void        * edid,
+                                       size_t              size,
+                                       XcmEdidInfo_s     * out )
 {
-  XCM_EDID_ERROR_e error = XCM_EDID_OK;
-  char * t = 0;
-  int len, i, j;
-  char mnf[4], * num;
-  uint16_t mnft_id = 0, model_id = 0, week = 0, year = 0;
+  int i, j;
+  char mnf[4];
+  uint16_t mnft_id = 0, model_id = 0;
   uint32_t serial_id = 0;
-  char * serial = 0, * manufacturer = 0, * model = 0, * vendor = 0,
-       * mnft = 0;
-  double c[9] = {0,0,0,0,0,0,0,0,0};
-  double a[6] = {0,0,0,0,0,0};
-  int pos = 0;
-  int has_cmd = 0;
-  XcmEdid_s * edi = edid;
+  double c[9] = {0,0,0,0,0,0,0,0,0},
+         lum[3] = {0,0,0};
+  const XcmEdid_s * edi = edid;
 
+  if(!out)
+    return XCM_EDID_WRONG_ARGUMENT;
 
-  *list = calloc( 24, sizeof(XcmEdidKeyValue_s) );
+  memset( out, 0, sizeof(XcmEdidInfo_s) );
+
+  if(!edi)
+    return XCM_EDID_WRONG_ARGUMENT;
+
+  /* a standalone DisplayID structure without EDID */
+  if(size >= 5 && XcmEdidParseDisplayID( edid, size, 1, out, lum ) == 0)
+  {
+    XcmEdidApplyDisplayIDLuminance( out, lum );
+    if(!(out->flags & XCM_EDID_INFO_MODEL))
+      sprintf( out->model, "%d", out->model_id );
+    return XCM_EDID_OK;
+  }
+
+  if(size < 128)
+    return XCM_EDID_WRONG_SIZE;
 
   /* check */
-  if(edi &&
-     edi->sig[0] == 0 &&
+  if(edi->sig[0] == 0 &&
      edi->sig[1] == 255 &&
      edi->sig[2] == 255 &&
      edi->sig[3] == 255 &&
@@ -223,8 +289,8 @@ XCM_EDID_ERROR_e  XcmEdidParse       ( void              * edid,
   if(XcmBigEndian())
     model_id = XcmValueUInt16Swap(model_id);
 
-  SET_INT( mnft_id )
-  SET_INT( model_id )
+  out->mnft_id = mnft_id;
+  out->model_id = model_id;
 
   memcpy(&serial_id, &edi->ser_id, sizeof(uint32_t));
   serial_id = XcmValueUInt32(serial_id);
@@ -235,17 +301,16 @@ XCM_EDID_ERROR_e  XcmEdidParse       ( void              * edid,
            edi->week, edi->year +1990,
            edi->width, edi->height, mnf );
 
-  week = edi->week;
-  year = edi->year + 1990;
-  SET_INT( week )
-  SET_INT( year )
+  out->week = edi->week;
+  out->year = edi->year + 1990;
 
   for( i = 0; i < 4; ++i)
   {
     /* we get i==0 -> text1, i==1 -> text2, ... i==3 -> text3 */
-    unsigned char * block;
-    char **target = NULL,
+    const unsigned char * block = NULL;
+    char * target = NULL,
          * tmp = 0;
+    int flag = 0;
 
     switch(i)
     {
@@ -263,29 +328,42 @@ XCM_EDID_ERROR_e  XcmEdidParse       ( void              * edid,
         if(block[5] == 3)
         {
           uint16_t v;
-          has_cmd = 1;
+          int16_t raw;
+          double * a = &out->a3red;
+          out->flags |= XCM_EDID_INFO_CMD;
           for(j = 0; j < 6; ++j)
           {
-            v = XcmValueInt16Swap(*((int16_t*)&block[6+2*j]));
+            memcpy( &raw, &block[6+2*j], sizeof(raw) );
+            v = XcmValueInt16Swap(raw);
             a[j] = v / 100.0;
           }
         }
-      } else if( type == 255 && !(serial && serial[0]) ) { /* serial */
-        target = &serial;
-      } else if( type == 254 && !(vendor && vendor[0]) ) { /* vendor */
-        target = &vendor;
+      } else if( type == 255 && !(out->flags & XCM_EDID_INFO_SERIAL &&
+                                  out->serial[0]) ) { /* serial */
+        target = out->serial; flag = XCM_EDID_INFO_SERIAL;
+      } else if( type == 254 && !(out->flags & XCM_EDID_INFO_VENDOR &&
+                                  out->vendor[0]) ) { /* vendor */
+        target = out->vendor; flag = XCM_EDID_INFO_VENDOR;
       } else if( type == 253 ) { /* frequenz ranges */
-      } else if( type == 252 && !(model && model[0]) ) { /* model */
-        target = &model;
+      } else if( type == 252 && !(out->flags & XCM_EDID_INFO_MODEL &&
+                                  out->model[0]) ) { /* model */
+        target = out->model; flag = XCM_EDID_INFO_MODEL;
       }
       if(target)
       {
-        len = strlen((char*)&block[5]);
-        if(len) {
-          ++len;
-          t = (char*)malloc( 16 );
-          snprintf(t, 15, "%s", (char*)&block[5]);
-          t[15] = '\000';
+        /* text may run over into the following bytes, but not past the
+         * 128 byte block */
+        const char * text = (const char*)&block[5];
+        int max = 128 - (int)((const unsigned char*)text - (const unsigned char*)edi);
+        char t[16];
+
+        if(max > 14)
+          max = 14;
+        for(j = 0; j < max && text[j]; ++j)
+          t[j] = text[j];
+        t[j] = '\000';
+
+        if(j) {
           if(strrchr(t, '\n'))
           {
             tmp = strrchr(t, '\n');
@@ -297,170 +375,711 @@ XCM_EDID_ERROR_e  XcmEdidParse       ( void              * edid,
           {
             if(type == 254)
             {
-              if(!serial)
-                target = &serial;
-              else
-              if(serial && !model)
-                target = &model;
+              if(!(out->flags & XCM_EDID_INFO_SERIAL))
+              {
+                target = out->serial; flag = XCM_EDID_INFO_SERIAL;
+              } else
+              if(!(out->flags & XCM_EDID_INFO_MODEL))
+              {
+                target = out->model; flag = XCM_EDID_INFO_MODEL;
+              }
             }
           }
         
-          *target = t;
+          strcpy( target, t );
+          out->flags |= flag;
         }
       }
     }
   }
 
-  SET_TXT( vendor )
-  SET_TXT( model )
-  SET_TXT( serial )
+  XcmCheckText( out->vendor );
+  XcmCheckText( out->model );
+  XcmCheckText( out->serial );
+
+  if(!(out->flags & XCM_EDID_INFO_MODEL))
+    sprintf( out->model, "%d", model_id );
+
+  decode_color_characteristics( edid, c );
+
+  out->red_x = c[0];
+  out->red_y = c[1];
+  out->green_x = c[2];
+  out->green_y = c[3];
+  out->blue_x = c[4];
+  out->blue_y = c[5];
+  out->white_x = c[6];
+  out->white_y = c[7];
+
+  /* Gamma */
+  if (edi->gamma_factor == 0xFF)
+    out->gamma = -1.0;
+  else
+    out->gamma = (edi->gamma_factor + 100.0) / 100.0;
+
+  {
+    const char * name = XcmEdidVendorName( mnft_id );
+
+    snprintf( out->manufacturer, sizeof(out->manufacturer), "%s",
+              name ? name : mnf );
+    XcmCheckText( out->manufacturer );
+  }
+  sprintf( out->mnft, "%s", mnf );
+  XcmCheckText( out->mnft );
+
+  XcmEdidParseExtensions( edid, size, out );
+
+  return XCM_EDID_OK;
+}
 
-  if(!model)
+/* CEA-861 data block tags */
+#define XCM_CEA_EXTENSION_TAG            0x02
+#define XCM_CEA_EXTENDED_TAG             7
+#define XCM_CEA_VIDEO_CAPABILITY         0x00
+#define XCM_CEA_COLORIMETRY              0x05
+#define XCM_CEA_HDR_STATIC_METADATA      0x06
+
+/* @internal
+ * read the data block collection of one CEA-861 extension block */
+static void         XcmEdidParseCEA  ( const unsigned char * block,
+                                       XcmEdidInfo_s     * out )
+{
+  int dtd = block[2],
+      pos = 4;
+
+  /* no data block collection */
+  if(dtd < 4 || dtd > 127)
+    return;
+
+  while(pos < dtd)
   {
-    num = malloc(128);
-    if(num)
+    int tag = block[pos] >> 5,
+        len = block[pos] & 31;
+    const unsigned char * d = &block[pos + 1];
+
+    if(pos + 1 + len > dtd)
+      break;
+
+    if(tag == XCM_CEA_EXTENDED_TAG && len >= 2)
     {
-      sprintf(num, "%d", model_id);
-      model = num;
-      SET_TXT( model )
-      num = model = 0;
+      switch(d[0])
+      {
+      case XCM_CEA_VIDEO_CAPABILITY:
+        out->video_capability = d[1];
+        out->flags |= XCM_EDID_INFO_VIDEO_CAPABILITY;
+        break;
+      case XCM_CEA_COLORIMETRY:
+        if(len >= 3)
+        {
+          out->colorimetry = d[1] | (d[2] << 8);
+          out->flags |= XCM_EDID_INFO_COLORIMETRY;
+        }
+        break;
+      case XCM_CEA_HDR_STATIC_METADATA:
+        out->eotf = d[1] & 63;
+        out->flags |= XCM_EDID_INFO_EOTF;
+        /* d[2] lists static metadata descriptor types */
+        if(len >= 4 && d[3])
+        {
+          out->max_luminance = 50.0 * pow( 2.0, d[3] / 32.0 );
+          out->flags |= XCM_EDID_INFO_MAX_LUMINANCE;
+        }
+        if(len >= 5 && d[4])
+        {
+          out->max_frame_avg_luminance = 50.0 * pow( 2.0, d[4] / 32.0 );
+          out->flags |= XCM_EDID_INFO_MAX_FALL;
+        }
+        /* the minimum is relative to the maximum */
+        if(len >= 6 && out->flags & XCM_EDID_INFO_MAX_LUMINANCE)
+        {
+          out->min_luminance = out->max_luminance * (d[5] / 255.0) *
+                               (d[5] / 255.0) / 100.0;
+          out->flags |= XCM_EDID_INFO_MIN_LUMINANCE;
+        }
+        break;
+      }
     }
+
+    pos += 1 + len;
   }
+}
 
-  decode_color_characteristics( edid, c );
+#define XCM_DISPLAYID_EXTENSION_TAG      0x70
+#define XCM_DISPLAYID_PRODUCT_ID         0x20
+#define XCM_DISPLAYID_DISPLAY_PARAMETERS 0x21
+
+/* @internal
+ * IEEE 754 half precision as used for DisplayID luminance */
+static double       XcmHalfToDouble  ( const unsigned char * le )
+{
+  int h = le[0] | (le[1] << 8),
+      e = (h >> 10) & 31,
+      m = h & 1023;
+  double v;
+
+  if(e == 31) /* infinity and NaN */
+    return 0.0;
+  if(e == 0)
+    v = ldexp( m, -24 );
+  else
+    v = ldexp( m + 1024, e - 25 );
 
-  XcmEdidSetDouble( &(*list)[pos++], XCM_EDID_KEY_REDx, c[0] );
-  XcmEdidSetDouble( &(*list)[pos++], XCM_EDID_KEY_REDy, c[1] );
-  XcmEdidSetDouble( &(*list)[pos++], XCM_EDID_KEY_GREENx, c[2] );
-  XcmEdidSetDouble( &(*list)[pos++], XCM_EDID_KEY_GREENy, c[3] );
-  XcmEdidSetDouble( &(*list)[pos++], XCM_EDID_KEY_BLUEx, c[4] );
-  XcmEdidSetDouble( &(*list)[pos++], XCM_EDID_KEY_BLUEy, c[5] );
-  XcmEdidSetDouble( &(*list)[pos++], XCM_EDID_KEY_WHITEx, c[6] );
-  XcmEdidSetDouble( &(*list)[pos++], XCM_EDID_KEY_WHITEy, c[7] );
+  return (h & 0x8000) ? -v : v;
+}
 
-  if( has_cmd == 1 )
+/* @internal
+ * 12 bit x and 12 bit y packed into three bytes */
+static void         XcmEdidDecodeDisplayIDxy (
+                                       const unsigned char * d,
+                                       double            * x,
+                                       double            * y )
+{
+  *x = (d[0] | ((d[1] & 0x0F) << 8)) / 4096.0;
+  *y = ((d[1] >> 4) | (d[2] << 4)) / 4096.0;
+}
+
+/* @internal
+ * read a DisplayID 2.x section in place; product identification is only
+ * taken from a standalone section, a EDID base block has its own;
+ * luminance receives max frame-average, max and min luminance, to be
+ * applied after all CEA blocks with XcmEdidApplyDisplayIDLuminance()
+ *
+ * @return 0 for a valid section, -1 otherwise */
+static int          XcmEdidParseDisplayID (
+                                       const unsigned char * section,
+                                       size_t              size,
+                                       int                 standalone,
+                                       XcmEdidInfo_s     * out,
+                                       double            * luminance )
+{
+  int bytes = section[1],
+      pos = 4,
+      i;
+  unsigned char sum = 0;
+
+  if((section[0] >> 4) != 2 || (size_t)bytes + 5 > size)
+    return -1;
+  for(i = 0; i < bytes + 5; ++i)
+    sum += section[i];
+  if(sum)
+    return -1;
+
+  while(pos + 3 <= bytes + 4)
   {
-    XcmEdidSetDouble( &(*list)[pos++], XCM_EDID_KEY_A3RED, a[0] );
-    XcmEdidSetDouble( &(*list)[pos++], XCM_EDID_KEY_A2RED, a[1] );
-    XcmEdidSetDouble( &(*list)[pos++], XCM_EDID_KEY_A3GREEN, a[2] );
-    XcmEdidSetDouble( &(*list)[pos++], XCM_EDID_KEY_A2GREEN, a[3] );
-    XcmEdidSetDouble( &(*list)[pos++], XCM_EDID_KEY_A3BLUE, a[4] );
-    XcmEdidSetDouble( &(*list)[pos++], XCM_EDID_KEY_A2BLUE, a[5] );
+    int tag = section[pos],
+        len = section[pos + 2];
+    const unsigned char * d = &section[pos + 3];
+
+    /* padding */
+    if(tag == 0 || pos + 3 + len > bytes + 4)
+      break;
+
+    if(tag == XCM_DISPLAYID_PRODUCT_ID && len >= 12 && standalone)
+    {
+      int n = d[11];
+
+      out->model_id = d[3] | (d[4] << 8);
+      out->week = d[9];
+      out->year = d[10] + 2000;
+      if(n > len - 12)
+        n = len - 12;
+      if(n > (int)sizeof(out->model) - 1)
+        n = (int)sizeof(out->model) - 1;
+      if(n > 0)
+      {
+        memcpy( out->model, &d[12], n );
+        out->model[n] = '\000';
+        XcmCheckText( out->model );
+        out->flags |= XCM_EDID_INFO_MODEL;
+      }
+    } else
+    if(tag == XCM_DISPLAYID_DISPLAY_PARAMETERS && len >= 29)
+    {
+      double v;
+
+      XcmEdidDecodeDisplayIDxy( &d[9], &out->red_x, &out->red_y );
+      XcmEdidDecodeDisplayIDxy( &d[12], &out->green_x, &out->green_y );
+      XcmEdidDecodeDisplayIDxy( &d[15], &out->blue_x, &out->blue_y );
+      XcmEdidDecodeDisplayIDxy( &d[18], &out->white_x, &out->white_y );
+
+      /* full screen coverage compares best to frame-average */
+      v = XcmHalfToDouble( &d[21] );
+      if(v > 0.0)
+        luminance[0] = v;
+      /* 10% coverage is the peak */
+      v = XcmHalfToDouble( &d[23] );
+      if(v > 0.0)
+        luminance[1] = v;
+      v = XcmHalfToDouble( &d[25] );
+      if(v > 0.0)
+        luminance[2] = v;
+
+      if(d[28] != 0xFF)
+        out->gamma = (d[28] + 100.0) / 100.0;
+
+      out->flags |= XCM_EDID_INFO_DISPLAYID;
+    }
+
+    pos += 3 + len;
   }
 
-  /* Gamma */
-  if (edi->gamma_factor == 0xFF)
-    c[8] = -1.0;
-  else
-    c[8] = (edi->gamma_factor + 100.0) / 100.0;
+  return 0;
+}
 
-  XcmEdidSetDouble( &(*list)[pos++], XCM_EDID_KEY_GAMMA, c[8] );
+/* @internal
+ * DisplayID luminance wins over CEA HDR static metadata, but only for the
+ * values the DisplayID block has set */
+static void         XcmEdidApplyDisplayIDLuminance (
+                                       XcmEdidInfo_s     * out,
+                                       const double      * luminance )
+{
+  if(luminance[0] > 0.0)
+  {
+    out->max_frame_avg_luminance = luminance[0];
+    out->flags |= XCM_EDID_INFO_MAX_FALL;
+  }
+  if(luminance[1] > 0.0)
+  {
+    out->max_luminance = luminance[1];
+    out->flags |= XCM_EDID_INFO_MAX_LUMINANCE;
+  }
+  if(luminance[2] > 0.0)
+  {
+    out->min_luminance = luminance[2];
+    out->flags |= XCM_EDID_INFO_MIN_LUMINANCE;
+  }
+}
+
+/* @internal
+ * walk all extension blocks inside size in a single pass; DisplayID
+ * precedence is applied afterwards, independent of the block order */
+static void         XcmEdidParseExtensions (
+                                       const unsigned char * edid,
+                                       size_t              size,
+                                       XcmEdidInfo_s     * out )
+{
+  const XcmEdid_s * edi = (const XcmEdid_s*) edid;
+  int n = edi->extension_blocks,
+      i;
+  double luminance[3] = {0,0,0};
 
+  if(n > (int)(size / 128) - 1)
+    n = (int)(size / 128) - 1;
+
+  for(i = 1; i <= n; ++i)
   {
-    t = (char*)malloc( 80 );
-    if(!memcmp(mnf,"ACR",3))
-      sprintf(t, "Acer");
-    else if(!memcmp(mnf,"AUO",3))
-      sprintf(t, "AU Optronics");
-    else if(!memcmp(mnf,"APP",3))
-      sprintf(t, "Apple");
-    else if(!memcmp(mnf,"BDS",3))
-      sprintf(t, "Barco");
-    else if(!memcmp(mnf,"CPQ",3))
-      sprintf(t, "COMPAQ");
-    else if(!memcmp(mnf,"DEC",3))
-      sprintf(t, "Digital Equipment Corporation");
-    else if(!memcmp(mnf,"DEL",3))
-      sprintf(t, "Dell Computer");
-    else if(!memcmp(mnf,"DWE",3))
-      sprintf(t, "Daewoo");
-    else if(!memcmp(mnf,"EIZ",3))
-      sprintf(t, "EIZO");
-    else if(!memcmp(mnf,"GSM",3))
-      sprintf(t, "Goldstar Company Ltd"); /* as per gnome-desktop */
-    else if(!memcmp(mnf,"HSD",3))
-      sprintf(t, "HannStar");
-    else if(!memcmp(mnf,"HWP",3))
-      sprintf(t, "Hewlett Packard");
-    else if(!memcmp(mnf,"NEC",3))
-      sprintf(t, "NEC");
-    else if(!memcmp(mnf,"LGD",3))
-      sprintf(t, "LG Display");
-    else if(!memcmp(mnf,"LGE",3))
-      sprintf(t, "LG Electronics");
-    else if(!memcmp(mnf,"LEN",3))
-      sprintf(t, "Lenovo");
-    else if(!memcmp(mnf,"LPL",3))
-      sprintf(t, "LG Philips");
-    else if(!memcmp(mnf,"MEI",3))
-      sprintf(t, "Panasonic");
-    else if(!memcmp(mnf,"MEL",3))
-      sprintf(t, "Mitsubishi");
-    else if(!memcmp(mnf,"MID",3))
-      sprintf(t, "miro");
-    else if(!memcmp(mnf,"NOK",3))
-      sprintf(t, "Nokia");
-    else if(!memcmp(mnf,"NVD",3))
-      sprintf(t, "Nvidia");
-    else if(!memcmp(mnf,"PHL",3))
-      sprintf(t, "Philips");
-    else if(!memcmp(mnf,"QUA",3))
-      sprintf(t, "Quatographic");
-    else if(!memcmp(mnf,"SAM",3))
-      sprintf(t, "Samsung");
-    else if(!memcmp(mnf,"SEC",3))
-      sprintf(t, "Seiko Epson Corporation");
-    else if(!memcmp(mnf,"SNI",3))
-      sprintf(t, "Siemens Nixdorf");
-    else if(!memcmp(mnf,"SNY",3))
-      sprintf(t, "Sony");
-    else
-      sprintf(t, "%s", mnf);
+    const unsigned char * block = edid + 128 * i;
+
+    if(block[0] == XCM_CEA_EXTENSION_TAG)
+      XcmEdidParseCEA( block, out );
+    else if(block[0] == XCM_DISPLAYID_EXTENSION_TAG)
+      /* the section ends before the block checksum */
+      XcmEdidParseDisplayID( block + 1, 126, 0, out, luminance );
 
-    manufacturer = t;
+    ++out->extensions;
   }
-  mnft = (char*)malloc( 24 );
-  sprintf(mnft, "%s", mnf);
 
-  SET_TXT( mnft )
-  SET_TXT( manufacturer )
+  XcmEdidApplyDisplayIDLuminance( out, luminance );
+}
+
+/** Function XcmEdidParse
+ *  @brief   EDID to key/value pair transformation
+ *
+ *  The function performs no verification of the data block other than the
+ *  first eight byte block signature. It reads only the 128 byte base block
+ *  and never touches extension blocks. Use XcmEdidParseSized() to include
+ *  them.
+ *
+ *  @param[in]     edid                EDID data block 128 bytes long
+ *  @param[out]    list                the key/value data structures
+ *  @param[in,out] count               pass in a pointer to a int. gives the 
+ *                                     number of elements in list
+ *  @return                            error code
+ *
+ *  @version libXcm: 0.5.5
+ *  @since   2009/12/12 (libXcm: 0.3.0)
+ *  @date    2026/10/17
+ */
+XCM_EDID_ERROR_e  XcmEdidParse       ( void              * edid,
+                                       XcmEdidKeyValue_s** list,
+                                       int               * count )
+{
+  return XcmEdidParseSized( edid, 128, list, count );
+}
+
+/** Function XcmEdidParseSized
+ *  @brief   EDID with extensions to key/value pair transformation
+ *
+ *  Same as XcmEdidParse(), but the values of the extension blocks inside
+ *  size are included, like with XcmEdidParseInto().
+ *
+ *  @param[in]     edid                EDID or DisplayID data block
+ *  @param[in]     size                size of edid in bytes
+ *  @param[out]    list                the key/value data structures
+ *  @param[in,out] count               gives the number of elements in list
+ *  @return                            error code
+ *
+ *  @version libXcm: 0.5.5
+ *  @since   2026/10/17 (libXcm: 0.5.5)
+ *  @date    2026/10/17
+ */
+XCM_EDID_ERROR_e  XcmEdidParseSized  ( const void        * edid,
+                                       size_t              size,
+                                       XcmEdidKeyValue_s** list,
+                                       int               * count )
+{
+  XCM_EDID_ERROR_e error = XCM_EDID_OK;
+  int pos = 0;
+  XcmEdidList_s * l = calloc( 1, sizeof(XcmEdidList_s) );
+  XcmEdidInfo_s * info;
+
+  *list = NULL;
+  *count = 0;
+  if(!l)
+    return XCM_EDID_NO_MEMORY;
+  info = &l->info;
+
+  error = XcmEdidParseInto( edid, size, info );
+  if(error != XCM_EDID_OK)
+  {
+    free( l );
+    return error;
+  }
+
+  *list = l->list;
+  memset( l->slot, -1, sizeof(l->slot) );
+
+  SET_INT( mnft_id, MNFT_ID )
+  SET_INT( model_id, MODEL_ID )
+  SET_INT( week, WEEK )
+  SET_INT( year, YEAR )
+
+  if(info->flags & XCM_EDID_INFO_VENDOR)
+    SET_TXT( vendor, VENDOR )
+  if(info->flags & XCM_EDID_INFO_MODEL)
+    SET_TXT( model, MODEL )
+  if(info->flags & XCM_EDID_INFO_SERIAL)
+    SET_TXT( serial, SERIAL )
+  if(!(info->flags & XCM_EDID_INFO_MODEL))
+    SET_TXT( model, MODEL )
+
+  SET_DBL( red_x, REDx )
+  SET_DBL( red_y, REDy )
+  SET_DBL( green_x, GREENx )
+  SET_DBL( green_y, GREENy )
+  SET_DBL( blue_x, BLUEx )
+  SET_DBL( blue_y, BLUEy )
+  SET_DBL( white_x, WHITEx )
+  SET_DBL( white_y, WHITEy )
+
+  if(info->flags & XCM_EDID_INFO_CMD)
+  {
+    SET_DBL( a3red, A3RED )
+    SET_DBL( a2red, A2RED )
+    SET_DBL( a3green, A3GREEN )
+    SET_DBL( a2green, A2GREEN )
+    SET_DBL( a3blue, A3BLUE )
+    SET_DBL( a2blue, A2BLUE )
+  }
+
+  SET_DBL( gamma, GAMMA )
+
+  SET_TXT( mnft, MNFT )
+  SET_TXT( manufacturer, MANUFACTURER )
+
+  if(info->flags & XCM_EDID_INFO_EOTF)
+  { SET_SLOT(EOTF)
+    XcmEdidSetInt( &(*list)[pos++], XCM_EDID_KEY_EOTF, info->eotf ); }
+  if(info->flags & XCM_EDID_INFO_MAX_LUMINANCE)
+    SET_DBL( max_luminance, MAX_LUMINANCE )
+  if(info->flags & XCM_EDID_INFO_MAX_FALL)
+    SET_DBL( max_frame_avg_luminance, MAX_FALL )
+  if(info->flags & XCM_EDID_INFO_MIN_LUMINANCE)
+    SET_DBL( min_luminance, MIN_LUMINANCE )
+  if(info->flags & XCM_EDID_INFO_COLORIMETRY)
+  { SET_SLOT(COLORIMETRY)
+    XcmEdidSetInt( &(*list)[pos++], XCM_EDID_KEY_COLORIMETRY, info->colorimetry ); }
+  if(info->flags & XCM_EDID_INFO_VIDEO_CAPABILITY)
+  { SET_SLOT(VIDEO_CAPABILITY)
+    XcmEdidSetInt( &(*list)[pos++], XCM_EDID_KEY_VIDEO_CAPABILITY,
+                   info->video_capability ); }
 
   *count = pos;
 
   return error;
 }
 
+/** Function XcmEdidVendorName
+ *  @brief   look up the manufacturer name of a PNP vendor ID
+ *
+ *  The lookup is a direct index into a table generated from pnp.ids.
+ *  Both builds take the full registry from the hwdata pnp.ids, when they
+ *  find it: CMake through XCM_PNP_IDS, configure through --with-pnp-ids.
+ *  Without it only the shipped src/XcmPnpIds.h is compiled in. That is
+ *  the short cmake/pnp.ids list of about 70 common monitor and panel
+ *  vendors; any other ID returns NULL and the parser reports the three
+ *  letter code as manufacturer.
+ *
+ *  @param[in]     mnft_id             packed 15 bit manufacturer ID as in
+ *                                     XcmEdidInfo_s::mnft_id
+ *  @return                            library owned name or NULL if unknown
+ *
+ *  @version libXcm: 0.5.5
+ *  @since   2026/10/17 (libXcm: 0.5.5)
+ *  @date    2026/10/17
+ */
+const char *      XcmEdidVendorName  ( uint16_t            mnft_id )
+{
+  int page, vendor;
+
+  mnft_id &= 0x7fff;
+  page = xcm_pnp_page[mnft_id >> 5];
+  if(!page)
+    return NULL;
+  vendor = xcm_pnp_slot[page - 1][mnft_id & 31];
+  if(!vendor)
+    return NULL;
+
+  return &xcm_pnp_names[xcm_pnp_offset[vendor - 1]];
+}
+
+/** Function XcmEdidGet
+ *  @brief   find a key in a XcmEdidParse() list
+ *
+ *  The lookup is a direct index and needs no string compare.
+ *
+ *  @param[in]     list                the key/value data structures
+ *  @param[in]     id                  the key to look for
+ *  @return                            the list entry or NULL if not present
+ *
+ *  @version libXcm: 0.5.5
+ *  @since   2026/10/17 (libXcm: 0.5.5)
+ *  @date    2026/10/17
+ */
+const XcmEdidKeyValue_s * XcmEdidGet ( const XcmEdidKeyValue_s * list,
+                                       XCM_EDID_ID_e       id )
+{
+  const XcmEdidList_s * l;
+  int pos;
+
+  if(!list || (int)id < 0 || id >= XCM_EDID_ID_COUNT)
+    return NULL;
+
+  l = XcmEdidListFromKeyValue(list);
+  pos = l->slot[id];
+
+  return pos < 0 ? NULL : &list[pos];
+}
+
 /** Function XcmEdidFree
  *  @brief   free library allocated list
  *
  *  @param[in,out] list                the key/value data structures
  *  @return                            error code
  *
- *  @version libXcm: 0.3.0
+ *  @version libXcm: 0.5.5
  *  @since   2009/12/12 (libXcm: 0.3.0)
- *  @date    2010/10/01
+ *  @date    2026/10/17
  */
 XCM_EDID_ERROR_e  XcmEdidFree        ( XcmEdidKeyValue_s** list )
 {
-  int pos = 0;
-  XcmEdidKeyValue_s * l = 0;
-
-  if(!list)
+  if(!list || !*list)
     return XCM_EDID_OK;
 
-  l = *list;
+  /* text values point into the same allocation */
+  free( XcmEdidListFromKeyValue(*list) );
+  *list = 0;
+
+  return XCM_EDID_OK;
+}
+
+/* @internal
+ * one slice of a batch job */
+typedef struct {
+  const void *const * edids;
+  const size_t      * sizes;
+  const char        * blocks;
+  size_t              stride;
+  int                 start;
+  int                 end;
+  XcmEdidInfo_s     * out;
+  XCM_EDID_ERROR_e  * errors;
+  XCM_EDID_ERROR_e    error;           /* first error inside the slice */
+} XcmEdidBatch_s;
+
+static void *       XcmEdidBatchRun  ( void              * arg )
+{
+  XcmEdidBatch_s * job = arg;
+  int i;
 
-  while(l[pos].key)
+  for(i = job->start; i < job->end; ++i)
   {
-    if(l[pos].type == XCM_EDID_VALUE_TEXT && l[pos].value.text)
-      free( l[pos].value.text );
-    ++pos;
+    XCM_EDID_ERROR_e err;
+
+    if(job->blocks)
+      err = XcmEdidParseInto( job->blocks + (size_t)i * job->stride,
+                              job->stride, &job->out[i] );
+    else
+      err = XcmEdidParseInto( job->edids[i], job->sizes ? job->sizes[i] : 128,
+                              &job->out[i] );
+
+    if(job->errors)
+      job->errors[i] = err;
+    if(err != XCM_EDID_OK && job->error == XCM_EDID_OK)
+      job->error = err;
   }
 
-  free(*list);
-  *list = 0;
+  return NULL;
+}
 
-  return XCM_EDID_OK;
+#define XCM_EDID_BATCH_MAX_THREADS 64
+#define XCM_EDID_BATCH_MIN_SLICE 256
+
+static XCM_EDID_ERROR_e XcmEdidBatch ( XcmEdidBatch_s    * job,
+                                       int                 n,
+                                       int                 threads )
+{
+  XcmEdidBatch_s jobs[XCM_EDID_BATCH_MAX_THREADS];
+  XCM_EDID_ERROR_e error = XCM_EDID_OK;
+  int i;
+#if defined(XCM_HAVE_LINUX)
+  pthread_t tids[XCM_EDID_BATCH_MAX_THREADS];
+  int started[XCM_EDID_BATCH_MAX_THREADS];
+
+  if(threads <= 0)
+    threads = (int)sysconf( _SC_NPROCESSORS_ONLN );
+#endif
+
+  if(threads > XCM_EDID_BATCH_MAX_THREADS)
+    threads = XCM_EDID_BATCH_MAX_THREADS;
+  /* thread start up is more expensive than parsing a few blocks */
+  if(threads > n / XCM_EDID_BATCH_MIN_SLICE)
+    threads = n / XCM_EDID_BATCH_MIN_SLICE;
+  if(threads < 1)
+    threads = 1;
+
+  for(i = 0; i < threads; ++i)
+  {
+    jobs[i] = *job;
+    jobs[i].start = (int)((long long)n * i / threads);
+    jobs[i].end = (int)((long long)n * (i + 1) / threads);
+    jobs[i].error = XCM_EDID_OK;
+  }
+
+#if defined(XCM_HAVE_LINUX)
+  for(i = 1; i < threads; ++i)
+    started[i] = pthread_create( &tids[i], NULL, XcmEdidBatchRun, &jobs[i] ) == 0;
+  XcmEdidBatchRun( &jobs[0] );
+  for(i = 1; i < threads; ++i)
+  {
+    if(started[i])
+      pthread_join( tids[i], NULL );
+    else
+      /* no thread available, do the slice here */
+      XcmEdidBatchRun( &jobs[i] );
+  }
+#else
+  for(i = 0; i < threads; ++i)
+    XcmEdidBatchRun( &jobs[i] );
+#endif
+
+  for(i = 0; i < threads; ++i)
+    if(jobs[i].error != XCM_EDID_OK)
+    {
+      error = jobs[i].error;
+      break;
+    }
+
+  return error;
+}
+
+/** Function XcmEdidParseBatch
+ *  @brief   parse many EDID blocks into fixed structures
+ *
+ *  Each element is parsed like with XcmEdidParseInto(). The work is split
+ *  into contiguous slices, one per thread. Small batches use fewer threads,
+ *  as each thread gets at least 256 elements.
+ *
+ *  @param[in]     edids               array of n EDID data blocks
+ *  @param[in]     sizes               array of n sizes; NULL means 128 each
+ *  @param[in]     n                   number of elements
+ *  @param[out]    out                 array of n results
+ *  @param[out]    errors              optional array of n error codes
+ *  @param[in]     threads             number of threads; 0 means one per
+ *                                     online CPU, 1 parses in the caller
+ *  @return                            the error of the first failing
+ *                                     element or XCM_EDID_OK
+ *
+ *  @version libXcm: 0.5.5
+ *  @since   2026/10/17 (libXcm: 0.5.5)
+ *  @date    2026/10/17
+ */
+XCM_EDID_ERROR_e  XcmEdidParseBatch  ( const void *const * edids,
+                                       const size_t      * sizes,
+                                       int                 n,
+                                       XcmEdidInfo_s     * out,
+                                       XCM_EDID_ERROR_e  * errors,
+                                       int                 threads )
+{
+  XcmEdidBatch_s job;
+
+  if(n <= 0)
+    return XCM_EDID_OK;
+  if(!edids || !out)
+    return XCM_EDID_WRONG_ARGUMENT;
+
+  memset( &job, 0, sizeof(job) );
+  job.edids = edids;
+  job.sizes = sizes;
+  job.out = out;
+  job.errors = errors;
+
+  return XcmEdidBatch( &job, n, threads );
+}
+
+/** Function XcmEdidParseBlocks
+ *  @brief   parse a contiguous array of EDID blocks into fixed structures
+ *
+ *  Same as XcmEdidParseBatch() for n EDIDs stored back to back in one
+ *  buffer, each stride bytes long.
+ *
+ *  @param[in]     blocks              n * stride bytes of EDID data
+ *  @param[in]     stride              size of each EDID; a multiple of 128
+ *  @param[in]     n                   number of elements
+ *  @param[out]    out                 array of n results
+ *  @param[out]    errors              optional array of n error codes
+ *  @param[in]     threads             number of threads; 0 means one per
+ *                                     online CPU, 1 parses in the caller
+ *  @return                            the error of the first failing
+ *                                     element or XCM_EDID_OK
+ *
+ *  @version libXcm: 0.5.5
+ *  @since   2026/10/17 (libXcm: 0.5.5)
+ *  @date    2026/10/17
+ */
+XCM_EDID_ERROR_e  XcmEdidParseBlocks ( const void        * blocks,
+                                       size_t              stride,
+                                       int                 n,
+                                       XcmEdidInfo_s     * out,
+                                       XCM_EDID_ERROR_e  * errors,
+                                       int                 threads )
+{
+  XcmEdidBatch_s job;
+
+  if(n <= 0)
+    return XCM_EDID_OK;
+  if(!blocks || !out)
+    return XCM_EDID_WRONG_ARGUMENT;
+  if(stride < 128 || stride % 128)
+    return XCM_EDID_WRONG_SIZE;
+
+  memset( &job, 0, sizeof(job) );
+  job.blocks = blocks;
+  job.stride = stride;
+  job.out = out;
+  job.errors = errors;
+
+  return XcmEdidBatch( &job, n, threads );
 }
 
 /** Function XcmEdidErrorToString
@@ -480,76 +1099,200 @@ const char *   XcmEdidErrorToString    ( XCM_EDID_ERROR_e       error )
   {
   case XCM_EDID_OK: text = ""; break;
   case XCM_EDID_WRONG_SIGNATURE: text = "Could not verifiy EDID"; break;
+  case XCM_EDID_WRONG_SIZE: text = "EDID data block too small"; break;
+  case XCM_EDID_WRITE_FAIL: text = "Could not write text"; break;
+  case XCM_EDID_FILE_FAIL: text = "Could not access data base file"; break;
+  case XCM_EDID_WRONG_ARGUMENT: text = "Missing argument"; break;
+  case XCM_EDID_NO_MEMORY: text = "Out of memory"; break;
   }
   return text;
 }
 
 
 /* convinience functions */
-/** Function XcmEdidPrintString
- *  @brief   convert a EDID block into text
+
+/* @internal
+ * growable string which keeps track of its length */
+typedef struct {
+  char  * text;
+  size_t  len;
+  size_t  size;
+} XcmEdidString_s;
+
+static int          XcmEdidStringWrite(void              * user_data,
+                                       const char        * text,
+                                       size_t              len )
+{
+  XcmEdidString_s * s = user_data;
+
+  if(s->len + len + 1 > s->size)
+  {
+    size_t size = s->size ? s->size : 1024;
+    char * t;
+
+    while(s->len + len + 1 > size)
+      size *= 2;
+    t = realloc( s->text, size );
+    if(!t)
+      return 1;
+    s->text = t;
+    s->size = size;
+  }
+
+  memcpy( &s->text[s->len], text, len );
+  s->len += len;
+  s->text[s->len] = '\000';
+
+  return 0;
+}
+
+/* @internal
+ * format once into a stack buffer and pass it on */
+static int          XcmEdidWritef    ( XcmEdidWrite_f      write,
+                                       void              * user_data,
+                                       const char        * format,
+                                       ... )
+{
+  char buf[256], * t = buf;
+  va_list list;
+  int len, error;
+
+  va_start( list, format );
+  len = vsnprintf( buf, sizeof(buf), format, list );
+  va_end( list );
+
+  if(len < 0)
+    return 1;
+
+  if(len >= (int)sizeof(buf))
+  {
+    t = malloc( len + 1 );
+    if(!t)
+      return 1;
+    va_start( list, format );
+    vsnprintf( t, len + 1, format, list );
+    va_end( list );
+  }
+
+  error = write( user_data, t, len );
+
+  if(t != buf)
+    free( t );
+
+  return error;
+}
+
+/** Function XcmEdidWriteFILE
+ *  @brief   XcmEdidWrite_f for a FILE stream
+ *
+ *  @param[in]     fp                  a FILE pointer as user_data
+ *  @param[in]     text                text to write
+ *  @param[in]     len                 bytes in text
+ *  @return                            0 - success, 1 - error
+ *
+ *  @version libXcm: 0.5.5
+ *  @since   2026/10/17 (libXcm: 0.5.5)
+ *  @date    2026/10/17
+ */
+int               XcmEdidWriteFILE   ( void              * fp,
+                                       const char        * text,
+                                       size_t              len )
+{
+  return fwrite( text, 1, len, (FILE*) fp ) != len;
+}
+
+/** Function XcmEdidWriteString
+ *  @brief   stream a EDID block as text
+ *
+ *  The output is the same as from XcmEdidPrintString(), but goes piece
+ *  by piece to the write function. Extension blocks inside size are
+ *  included.
  *
  *  @param[in]     edid                the EDID data block
- *  @param[out]    text                the resulting text string
- *  @param[in]     alloc               a user provided function to allocate text
+ *  @param[in]     size                size of edid in bytes
+ *  @param[in]     write               receives the text
+ *  @param[in]     user_data           passed to write, e.g. a FILE pointer
+ *                                     for XcmEdidWriteFILE()
  *  @return                            error code
  *
- *  @version libXcm: 0.3.0
- *  @since   2009/12/12 (libXcm: 0.3.0)
- *  @date    2010/10/01
+ *  @version libXcm: 0.5.5
+ *  @since   2026/10/17 (libXcm: 0.5.5)
+ *  @date    2026/10/17
  */
-XCM_EDID_ERROR_e  XcmEdidPrintString ( void              * edid,
-                                       char             ** text,
-                                       void             *(*alloc)(size_t sz) )
+XCM_EDID_ERROR_e  XcmEdidWriteString ( void              * edid,
+                                       size_t              size,
+                                       XcmEdidWrite_f      write,
+                                       void              * user_data )
 {
   XcmEdidKeyValue_s * l = 0;
-  int count = 0, i;
-  XCM_EDID_ERROR_e err = XcmEdidParse( edid, &l, &count );
-  char * txt = alloc(1024);
-
-  txt[0] = 0;
+  int count = 0, i, error = 0;
+  XCM_EDID_ERROR_e err = XcmEdidParseSized( edid, size, &l, &count );
 
-  for(i = 0; i < count; ++i)
+  for(i = 0; i < count && !error; ++i)
   {
-    sprintf( &txt[strlen(txt)], "%s: ", l[i].key );
     if(l[i].type == XCM_EDID_VALUE_TEXT)
-      sprintf( &txt[strlen(txt)], "\"%s\"\n", l[i].value.text);
+      error = XcmEdidWritef( write, user_data, "%s: \"%s\"\n", l[i].key,
+                             l[i].value.text );
     if(l[i].type == XCM_EDID_VALUE_INT)
-      sprintf( &txt[strlen(txt)], "%d\n", l[i].value.integer);
+      error = XcmEdidWritef( write, user_data, "%s: %d\n", l[i].key,
+                             l[i].value.integer );
     if(l[i].type == XCM_EDID_VALUE_DOUBLE)
-      sprintf( &txt[strlen(txt)], "%g\n", l[i].value.dbl);
+      error = XcmEdidWritef( write, user_data, "%s: %g\n", l[i].key,
+                             l[i].value.dbl );
   }
 
-  if(count)
-    *text = txt;
-
   XcmEdidFree( &l );
 
+  if(error && err == XCM_EDID_OK)
+    err = XCM_EDID_WRITE_FAIL;
+
   return err;
 }
 
-/** Function XcmEdidPrintOpenIccJSON
- *  @brief   convert a EDID block into a device configuration
+/** Function XcmEdidWriteOpenIccJSON
+ *  @brief   stream a EDID block as device configuration
+ *
+ *  The output is the same as from XcmEdidPrintOpenIccJSON(), but goes
+ *  piece by piece to the write function. Extension blocks inside size are
+ *  included.
  *
  *  @param[in]     edid                the EDID data block
- *  @param[out]    text                the resulting text string
- *  @param[in]     alloc               a user provided function to allocate text
+ *  @param[in]     size                size of edid in bytes
+ *  @param[in]     write               receives the text
+ *  @param[in]     user_data           passed to write, e.g. a FILE pointer
+ *                                     for XcmEdidWriteFILE()
  *  @return                            error code
  *
- *  @version libXcm: 0.4.2
- *  @since   2011/06/19 (libXcm: 0.4.2)
- *  @date    2011/06/19
+ *  @version libXcm: 0.5.5
+ *  @since   2026/10/17 (libXcm: 0.5.5)
+ *  @date    2026/10/17
  */
-XCM_EDID_ERROR_e  XcmEdidPrintOpenIccJSON (
+XCM_EDID_ERROR_e  XcmEdidWriteOpenIccJSON (
                                        void              * edid,
-                                       char             ** text,
-                                       void             *(*alloc)(size_t sz) )
+                                       size_t              size,
+                                       XcmEdidWrite_f      write,
+                                       void              * user_data )
 {
   XcmEdidKeyValue_s * l = 0;
-  int count = 0, i;
-  XCM_EDID_ERROR_e err = XcmEdidParse( edid, &l, &count );
-  char * txt;
-  int year = 0, week = 0;
+  const XcmEdidKeyValue_s * week, * year;
+  int count = 0, i, error = 0;
+  XCM_EDID_ERROR_e err = XcmEdidParseSized( edid, size, &l, &count );
+  static const char head[] =
+  "{\n"
+  "  \"org\": {\n"
+  "    \"freedesktop\": {\n"
+  "      \"openicc\": {\n"
+  "        \"device\": {\n"
+  "          \"monitor\": [{\n"
+  "            \"prefix\": \"EDID_\",\n",
+                    tail[] =
+  "            }\n"
+  "          ]\n"
+  "        }\n"
+  "      }\n"
+  "    }\n"
+  "  }\n"
+  "}\n";
 
   if(!count)
   {
@@ -557,61 +1300,118 @@ XCM_EDID_ERROR_e  XcmEdidPrintOpenIccJSON (
     return err;
   }
 
-  txt = alloc( sizeof(char) * 4096 );
+  week = XcmEdidGet( l, XCM_EDID_ID_WEEK );
+  year = XcmEdidGet( l, XCM_EDID_ID_YEAR );
 
-  sprintf(txt,
-  "{\n"
-  "  \"org\": {\n"
-  "    \"freedesktop\": {\n"
-  "      \"openicc\": {\n"
-  "        \"device\": {\n"
-  "          \"monitor\": [{\n"
-  "            \"prefix\": \"EDID_\",\n"
-  );
+  error = write( user_data, head, sizeof(head) - 1 );
 
-  for(i = 0; i < count; ++i)
+  for(i = 0; i < count && !error; ++i)
   {
-    if(strcmp(l[i].key,"week") == 0)
-    {
-      week = l[i].value.integer;
+    if(&l[i] == week || &l[i] == year)
       continue;
-    } else
-    if(strcmp(l[i].key,"year") == 0)
-    {
-      year = l[i].value.integer;
-      continue;
-    }
-    sprintf( &txt[strlen(txt)], "              \"EDID_%s\": ", l[i].key );
+
     if(l[i].type == XCM_EDID_VALUE_TEXT)
-      sprintf( &txt[strlen(txt)], "\"%s\"", l[i].value.text);
+      error = XcmEdidWritef( write, user_data,
+                             "              \"EDID_%s\": \"%s\",\n",
+                             l[i].key, l[i].value.text );
     if(l[i].type == XCM_EDID_VALUE_INT)
-      sprintf( &txt[strlen(txt)], "\"%d\"", l[i].value.integer);
+      error = XcmEdidWritef( write, user_data,
+                             "              \"EDID_%s\": \"%d\",\n",
+                             l[i].key, l[i].value.integer );
     if(l[i].type == XCM_EDID_VALUE_DOUBLE)
-      sprintf( &txt[strlen(txt)], "\"%g\"", l[i].value.dbl);
-    sprintf( &txt[strlen(txt)], ",");
-    sprintf( &txt[strlen(txt)], "\n");
+      error = XcmEdidWritef( write, user_data,
+                             "              \"EDID_%s\": \"%g\",\n",
+                             l[i].key, l[i].value.dbl );
   }
 
-  sprintf( &txt[strlen(txt)], "              \"EDID_date\": \"%d-T%d\"\n",
-           year, week );
+  if(!error)
+    error = XcmEdidWritef( write, user_data,
+                           "              \"EDID_date\": \"%d-T%d\"\n",
+                           year ? year->value.integer : 0,
+                           week ? week->value.integer : 0 );
+  if(!error)
+    error = write( user_data, tail, sizeof(tail) - 1 );
 
-  sprintf( &txt[strlen(txt)], 
-  "            }\n"
-  "          ]\n"
-  "        }\n"
-  "      }\n"
-  "    }\n"
-  "  }\n"
-  "}\n"
-  );
+  XcmEdidFree( &l );
 
-  *text = txt;
+  if(error && err == XCM_EDID_OK)
+    err = XCM_EDID_WRITE_FAIL;
 
-  XcmEdidFree( &l );
+  return err;
+}
+
+/* @internal
+ * build the text and hand a exactly sized copy to the user */
+static XCM_EDID_ERROR_e XcmEdidPrint ( void              * edid,
+                                       char             ** text,
+                                       void             *(*alloc)(size_t sz),
+                                       XCM_EDID_ERROR_e (*stream)(void*, size_t, XcmEdidWrite_f, void*) )
+{
+  XcmEdidString_s s = {NULL, 0, 0};
+  /* the caller did not tell the size, so only the base block is safe */
+  XCM_EDID_ERROR_e err = stream( edid, 128, XcmEdidStringWrite, &s );
+
+  /* partial text is dropped; *text is only set on success */
+  if(err == XCM_EDID_OK && s.len)
+  {
+    char * txt = alloc( s.len + 1 );
+
+    if(txt)
+    {
+      memcpy( txt, s.text, s.len + 1 );
+      *text = txt;
+    } else
+      err = XCM_EDID_NO_MEMORY;
+  }
+
+  free( s.text );
 
   return err;
 }
 
+/** Function XcmEdidPrintString
+ *  @brief   convert a EDID block into text
+ *
+ *  @param[in]     edid                the EDID data block, 128 bytes;
+ *                                     extensions need XcmEdidWriteString()
+ *  @param[out]    text                the resulting text string; untouched
+ *                                     on error
+ *  @param[in]     alloc               a user provided function to allocate text
+ *  @return                            error code
+ *
+ *  @version libXcm: 0.5.5
+ *  @since   2009/12/12 (libXcm: 0.3.0)
+ *  @date    2026/10/17
+ */
+XCM_EDID_ERROR_e  XcmEdidPrintString ( void              * edid,
+                                       char             ** text,
+                                       void             *(*alloc)(size_t sz) )
+{
+  return XcmEdidPrint( edid, text, alloc, XcmEdidWriteString );
+}
+
+/** Function XcmEdidPrintOpenIccJSON
+ *  @brief   convert a EDID block into a device configuration
+ *
+ *  @param[in]     edid                the EDID data block, 128 bytes;
+ *                                     extensions need XcmEdidWriteOpenIccJSON()
+ *  @param[out]    text                the resulting text string; untouched
+ *                                     on error
+ *  @param[in]     alloc               a user provided function to allocate text
+ *  @return                            error code
+ *
+ *  @version libXcm: 0.5.5
+ *  @since   2011/06/19 (libXcm: 0.4.2)
+ *  @date    2026/10/17
+ */
+XCM_EDID_ERROR_e  XcmEdidPrintOpenIccJSON (
+                                       void              * edid,
+                                       char             ** text,
+                                       void             *(*alloc)(size_t sz) )
+{
+  return XcmEdidPrint( edid, text, alloc, XcmEdidWriteOpenIccJSON );
+}
+
 #define  XCM_EDID_COLOUR_MATRIX_SINGLE_GAMMA "colour_matrix.edid.redx_redy_greenx_greeny_bluex_bluey_whitex_whitey_gamma"
 XCM_EDID_ERROR_e  XcmEdidComposeString(void              * edid,
                                        const char        * key,
@@ -629,12 +1429,6 @@ XCM_EDID_ERROR_e  XcmEdidComposeString(void              * edid,
    Should be MIT licensed.
  */
 
-static int
-get_bit (int in, int bit)
-{
-    return (in & (1 << bit)) >> bit;
-}
-
 static int
 get_bits (int in, int begin, int end)
 {
@@ -646,15 +1440,8 @@ get_bits (int in, int begin, int end)
 static double
 decode_fraction (int high, int low)
 {
-    double result = 0.0;
-    int i;
-
-    high = (high << 2) | low;
-
-    for (i = 0; i < 10; ++i) 
-        result += get_bit (high, i) * pow (2, i - 10);
-
-    return result;
+    /* 10 bit fixed point; the division by a power of two is exact */
+    return ((high << 2) | low) / 1024.0;
 }
 
 static int
@@ -674,5 +1461,52 @@ decode_color_characteristics (const unsigned char *edid, double * c)
 
 /* END edid-parse.c_SECTION */
 
+/** Function XcmEdidDecodeChromaticity
+ *  @brief   decode the colour characteristics of many EDIDs
+ *
+ *  Converts the ten bit chromaticity values of n EDID base blocks into
+ *  doubles, in the order red_x, red_y, green_x, green_y, blue_x, blue_y,
+ *  white_x and white_y. Extension blocks are not looked at. So the values
+ *  differ from XcmEdidParseInto() for EDIDs with DisplayID display
+ *  parameters, which override the primaries of the base block.
+ *
+ *  @param[in]     blocks              n * stride bytes of EDID data
+ *  @param[in]     stride              distance between two EDIDs; >= 128
+ *  @param[in]     n                   number of EDIDs
+ *  @param[out]    colors              n * 8 doubles
+ *  @return                            error code
+ *
+ *  @version libXcm: 0.5.5
+ *  @since   2026/10/17 (libXcm: 0.5.5)
+ *  @date    2026/10/17
+ */
+XCM_EDID_ERROR_e  XcmEdidDecodeChromaticity (
+                                       const void        * blocks,
+                                       size_t              stride,
+                                       int                 n,
+                                       double            * colors )
+{
+  const unsigned char * edid = blocks;
+  int i;
+
+  if(n <= 0)
+    return XCM_EDID_OK;
+  if(!blocks || !colors)
+    return XCM_EDID_WRONG_ARGUMENT;
+  if(stride < 128)
+    return XCM_EDID_WRONG_SIZE;
+
+  for(i = 0; i < n; ++i, edid += stride, colors += 8)
+  {
+    int k;
+
+    for(k = 0; k < 8; ++k)
+      colors[k] = ((edid[0x1b + k] << 2) |
+                   ((edid[0x19 + k / 4] >> (6 - 2 * (k % 4))) & 3)) / 1024.0;
+  }
+
+  return XCM_EDID_OK;
+}
+
 /** @} XcmEdidParse */
 
@@ -887,6 +887,7 @@ void         XcmStringAdd_           ( char             ** text,
 }
 
 void         xcmeUnrollEdid1_       ( void              * edid,
+                                       size_t              size,
                                        char             ** manufacturer,
                                        char             ** mnft,
                                        char             ** model,
@@ -901,53 +902,44 @@ void         xcmeUnrollEdid1_       ( void              * edid,
 {
   int i, count = 0;
   XcmEdidKeyValue_s * list = 0;
+  const XcmEdidKeyValue_s * e;
   XCM_EDID_ERROR_e err = 0;
+  static const XCM_EDID_ID_e colour_ids[9] = {
+    XCM_EDID_ID_REDx, XCM_EDID_ID_REDy, XCM_EDID_ID_GREENx, XCM_EDID_ID_GREENy,
+    XCM_EDID_ID_BLUEx, XCM_EDID_ID_BLUEy, XCM_EDID_ID_WHITEx, XCM_EDID_ID_WHITEy,
+    XCM_EDID_ID_GAMMA };
 
-  err = XcmEdidParse( edid, &list, &count );
+  err = XcmEdidParseSized( edid, size, &list, &count );
   if(err != XCM_EDID_OK)
     DERR( "%s", XcmEdidErrorToString(err) );
 
+#define XCME_EDID_TXT(var, id) \
+  if(var && (e = XcmEdidGet( list, id )) != NULL) \
+    *var = XcmStringCopy_(e->value.text, allocate_func);
+#define XCME_EDID_INT(var, id) \
+  if(var && (e = XcmEdidGet( list, id )) != NULL) \
+    *var = e->value.integer;
+
   if(list)
-  for(i = 0; i < count; ++i)           
   {
-         if(manufacturer && strcmp( list[i].key, "manufacturer") == 0)
-      *manufacturer = XcmStringCopy_(list[i].value.text, allocate_func);
-    else if(mnft && strcmp( list[i].key, "mnft") == 0)
-      *mnft = XcmStringCopy_(list[i].value.text, allocate_func);
-    else if(model && strcmp( list[i].key, "model") == 0)
-      *model = XcmStringCopy_(list[i].value.text, allocate_func);
-    else if(serial && strcmp( list[i].key, "serial") == 0)
-      *serial = XcmStringCopy_(list[i].value.text, allocate_func);
-    else if(vendor && strcmp( list[i].key, "vendor") == 0)
-      *vendor = XcmStringCopy_(list[i].value.text, allocate_func);
-    else if(week && strcmp( list[i].key, "week") == 0)
-      *week = list[i].value.integer;    
-    else if(year && strcmp( list[i].key, "year") == 0)
-      *year = list[i].value.integer; 
-    else if(mnft_id && strcmp( list[i].key, "mnft_id") == 0)
-      *mnft_id = list[i].value.integer;
-    else if(model_id && strcmp( list[i].key, "model_id") == 0)
-      *model_id = list[i].value.integer;
-    else if(c && strcmp( list[i].key, "redx") == 0)
-      c[0] = list[i].value.dbl;
-    else if(c && strcmp( list[i].key, "redy") == 0)
-      c[1] = list[i].value.dbl;
-    else if(c && strcmp( list[i].key, "greenx") == 0)
-      c[2] = list[i].value.dbl;
-    else if(c && strcmp( list[i].key, "greeny") == 0)
-      c[3] = list[i].value.dbl;
-    else if(c && strcmp( list[i].key, "bluex") == 0)
-      c[4] = list[i].value.dbl;
-    else if(c && strcmp( list[i].key, "bluey") == 0)
-      c[5] = list[i].value.dbl;
-    else if(c && strcmp( list[i].key, "whitex") == 0)
-      c[6] = list[i].value.dbl;
-    else if(c && strcmp( list[i].key, "whitey") == 0)
-      c[7] = list[i].value.dbl;
-    else if(c && strcmp( list[i].key, "gamma") == 0)
-      c[8] = list[i].value.dbl;
+    XCME_EDID_TXT( manufacturer, XCM_EDID_ID_MANUFACTURER )
+    XCME_EDID_TXT( mnft, XCM_EDID_ID_MNFT )
+    XCME_EDID_TXT( model, XCM_EDID_ID_MODEL )
+    XCME_EDID_TXT( serial, XCM_EDID_ID_SERIAL )
+    XCME_EDID_TXT( vendor, XCM_EDID_ID_VENDOR )
+    XCME_EDID_INT( week, XCM_EDID_ID_WEEK )
+    XCME_EDID_INT( year, XCM_EDID_ID_YEAR )
+    XCME_EDID_INT( mnft_id, XCM_EDID_ID_MNFT_ID )
+    XCME_EDID_INT( model_id, XCM_EDID_ID_MODEL_ID )
+    if(c)
+      for(i = 0; i < 9; ++i)
+        if((e = XcmEdidGet( list, colour_ids[i] )) != NULL)
+          c[i] = e->value.dbl;
   }
 
+#undef XCME_EDID_TXT
+#undef XCME_EDID_INT
+
   if(list)
     XcmEdidFree( &list );
 }
@@ -1139,7 +1131,7 @@ int      XcmeContext_InLoop          ( XcmeContext_s    * c,
                  * model = 0,
                  * serial = 0;
 
-            xcmeUnrollEdid1_( data, &manufacturer,0,&model, &serial, 0,0,0,0,0,
+            xcmeUnrollEdid1_( data, n, &manufacturer,0,&model, &serial, 0,0,0,0,0,
                             colours, malloc );
             STRING_ADD( tmp, manufacturer ); STRING_ADD( tmp, " - " );
             STRING_ADD( tmp, model ); STRING_ADD( tmp, " - " );
@@ -0,0 +1,286 @@
+/*  @file XcmPnpIds.h
+ *
+ *  libXcm  Xorg Colour Management
+ *
+ *  @brief    PNP vendor ID table
+ *  @internal
+ *
+ *  Generated by cmake/XcmPnpIds.cmake from pnp.ids - do not edit.
+ */
+
+#ifndef __XCM_PNP_IDS_H__
+#define __XCM_PNP_IDS_H__
+
+#define XCM_PNP_VENDORS 67
+#define XCM_PNP_PAGES 56
+
+/* first two letters -> page number + 1, or 0 */
+static const uint16_t xcm_pnp_page[1024] = {
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,1,0,2,0,0,0,0,0,0,0,0,0,0,0,3,
+  4,0,0,0,0,5,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,6,0,0,0,0,0,0,0,0,0,7,8,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,9,0,0,
+  10,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,11,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,12,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,13,0,0,14,0,15,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,16,0,0,0,0,0,0,0,0,0,0,
+  0,0,17,0,0,0,0,18,0,0,0,0,0,0,0,0,
+  0,0,0,19,0,0,0,20,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,21,0,0,0,0,0,0,
+  22,0,0,23,0,0,0,24,0,0,0,0,0,0,0,0,
+  0,0,25,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,26,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,27,0,28,0,0,0,0,0,0,0,0,
+  29,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,30,0,0,0,31,0,0,0,32,0,0,0,0,0,0,
+  0,0,0,33,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,34,0,0,0,0,0,0,0,0,0,35,
+  0,0,0,0,0,0,36,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,37,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,38,39,0,0,0,0,40,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,41,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,42,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,43,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,44,0,0,45,46,0,47,48,0,0,0,0,0,49,0,
+  50,0,0,0,0,51,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,52,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,53,0,0,0,0,0,0,
+  0,0,0,54,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,55,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,56,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+};
+
+/* third letter -> vendor number + 1, or 0 */
+static const uint16_t xcm_pnp_slot[XCM_PNP_PAGES][32] = {
+  {0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+  {0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+  {0,0,0,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+  {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+  {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,0,0,0,7,0,0,0,0,0,0,0,0,0,0,0,0,},
+  {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,0,0,0,0,0,0,0,0,0,0,0,0,},
+  {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+  {0,0,0,0,0,10,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+  {0,0,0,0,0,0,0,0,0,0,0,0,0,0,11,12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+  {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+  {0,0,0,14,0,0,0,0,0,0,0,0,15,0,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+  {0,0,0,0,0,17,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+  {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,18,0,0,0,0,0,},
+  {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,19,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+  {0,0,0,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+  {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,21,0,0,0,0,0,0,0,0,0,0,0,0,},
+  {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,22,0,0,0,0,0,0,0,0,0,0,0,},
+  {0,0,0,0,0,0,0,0,0,0,0,0,23,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+  {0,0,0,0,0,0,0,0,0,0,0,0,0,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+  {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,0,0,0,0,0,0,},
+  {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,26,0,0,0,0,0,0,0,0,0,0,0,},
+  {0,0,0,0,0,0,0,0,0,0,0,0,0,0,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+  {0,0,0,0,28,0,0,0,0,0,0,0,29,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+  {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+  {0,0,0,0,0,0,0,0,0,0,0,0,0,31,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+  {0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,33,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+  {0,0,0,0,0,0,0,0,0,0,0,0,0,0,34,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+  {0,0,0,0,35,36,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+  {0,0,0,0,0,0,0,0,0,0,0,0,37,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+  {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,38,0,0,0,0,0,0,0,},
+  {0,0,0,0,39,0,0,0,0,40,0,0,41,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+  {0,0,0,0,42,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+  {0,0,0,0,0,0,0,0,0,43,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+  {0,0,0,44,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+  {0,0,0,0,0,0,0,0,0,0,0,45,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+  {0,0,0,0,46,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+  {0,0,0,0,0,0,0,0,0,0,0,47,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+  {0,0,0,0,0,0,0,0,0,0,0,0,48,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+  {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,49,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+  {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,50,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+  {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,51,0,0,0,0,0,0,0,0,0,0,0,0,},
+  {0,52,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+  {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,53,0,0,0,0,0,0,0,0,0,0,0,},
+  {0,0,0,0,0,0,0,0,0,0,0,0,0,54,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+  {0,0,0,55,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+  {0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+  {0,0,0,0,0,0,0,0,0,57,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+  {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,58,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+  {0,0,0,0,0,0,0,0,0,59,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,60,0,0,0,0,0,0,},
+  {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,61,0,0,0,0,0,0,0,0,0,0,0,},
+  {0,0,0,0,0,0,0,0,0,0,0,0,0,0,62,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+  {0,0,63,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+  {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,64,0,0,0,0,0,},
+  {0,0,0,65,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+  {0,0,0,66,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+  {0,0,0,0,0,0,0,0,67,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+};
+
+/* vendor number -> offset into xcm_pnp_names */
+static const uint32_t xcm_pnp_offset[XCM_PNP_VENDORS] = {
+  0,
+  9,
+  26,
+  31,
+  49,
+  55,
+  68,
+  85,
+  91,
+  96,
+  100,
+  115,
+  139,
+  146,
+  176,
+  190,
+  202,
+  209,
+  214,
+  235,
+  246,
+  262,
+  271,
+  278,
+  299,
+  312,
+  320,
+  328,
+  337,
+  344,
+  360,
+  364,
+  371,
+  382,
+  389,
+  400,
+  415,
+  426,
+  434,
+  441,
+  451,
+  462,
+  467,
+  477,
+  481,
+  487,
+  494,
+  512,
+  520,
+  551,
+  558,
+  573,
+  586,
+  594,
+  602,
+  618,
+  642,
+  659,
+  665,
+  681,
+  686,
+  703,
+  720,
+  728,
+  739,
+  749,
+  755,
+};
+
+static const char xcm_pnp_names[] =
+  "AcerView\000"
+  "ASUSTeK Computer\000"
+  "Acer\000"
+  "AOC International\000"
+  "Apple\000"
+  "AU Optronics\000"
+  "ASUSTeK Computer\000"
+  "Barco\000"
+  "BenQ\000"
+  "BOE\000"
+  "Chimei Innolux\000"
+  "Chi Mei Optoelectronics\000"
+  "COMPAQ\000"
+  "Digital Equipment Corporation\000"
+  "Dell Computer\000"
+  "Denon, Ltd.\000"
+  "Daewoo\000"
+  "EIZO\000"
+  "Elo TouchSystems Inc\000"
+  "Eizo Nanao\000"
+  "Fujitsu Siemens\000"
+  "Gigabyte\000"
+  "Google\000"
+  "Goldstar Company Ltd\000"
+  "Gateway 2000\000"
+  "Hitachi\000"
+  "HP Inc.\000"
+  "HannStar\000"
+  "Hansol\000"
+  "Hewlett Packard\000"
+  "IBM\000"
+  "Iiyama\000"
+  "InfoVision\000"
+  "Lenovo\000"
+  "LG Display\000"
+  "LG Electronics\000"
+  "LG Philips\000"
+  "Belinea\000"
+  "Medion\000"
+  "Panasonic\000"
+  "Mitsubishi\000"
+  "miro\000"
+  "Microstep\000"
+  "NEC\000"
+  "Nokia\000"
+  "Nvidia\000"
+  "ONKYO Corporation\000"
+  "Philips\000"
+  "Pioneer Electronic Corporation\000"
+  "Planar\000"
+  "Quanta Display\000"
+  "Quatographic\000"
+  "Red Hat\000"
+  "Samsung\000"
+  "Samsung Display\000"
+  "Seiko Epson Corporation\000"
+  "Silicon Graphics\000"
+  "Sharp\000"
+  "Siemens Nixdorf\000"
+  "Sony\000"
+  "Sceptre Tech Inc\000"
+  "Sun Microsystems\000"
+  "Toshiba\000"
+  "VIZIO, Inc\000"
+  "ViewSonic\000"
+  "Wacom\000"
+  "Yamaha Corporation\000"
+;
+
+#endif /* __XCM_PNP_IDS_H__ */
@@ -0,0 +1,466 @@
+/*  @file xcm-bench.c
+ *
+ *  libXcm  Xorg Colour Management
+ *
+ *  @par Copyright:
+ *            2026 (C) Kai-Uwe Behrmann
+ *
+ *  @brief    EDID parser and DDC benchmark on a synthetic corpus
+ *  @internal
+ *  @author   Kai-Uwe Behrmann <ku.b@gmx.de>
+ *  @par License:
+ *            MIT <http://www.opensource.org/licenses/mit-license.php>
+ *  @since    2026/10/17
+ *
+ *  xcm-bench [-n corpus_size] [-i iterations] [-s seed] [-d buses]
+ *            [-l latency_us] [-j]
+ *
+ *  The corpus is generated from the seed and is identical across runs and
+ *  versions. -d serves the first corpus EDIDs on simulated i2c buses and
+ *  times XcmDDClist() and XcmDDCgetEDID() through the mock transport, -l
+ *  sets its latency per transfer. -j prints JSON for storing and comparing
+ *  results.
+ */
+
+#include "XcmEdidParse.h"
+#include "XcmVersion.h"
+#if XCM_HAVE_LINUX
+#include "XcmDDC.h"
+#include <unistd.h>       /* rmdir() */
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+
+#define XCM_BENCH_EDID_SIZE 256
+#define XCM_BENCH_RESULTS 6
+
+/* allocation counting; glibc lets the executable interpose malloc for
+ * the library as well */
+static long xcm_bench_allocs = 0;
+#if defined(__GLIBC__)
+#define XCM_BENCH_COUNT_ALLOCS 1
+extern void * __libc_malloc          ( size_t              size );
+extern void * __libc_calloc          ( size_t              n,
+                                       size_t              size );
+extern void * __libc_realloc         ( void              * ptr,
+                                       size_t              size );
+void *       malloc                  ( size_t              size )
+{ ++xcm_bench_allocs; return __libc_malloc( size ); }
+void *       calloc                  ( size_t              n,
+                                       size_t              size )
+{ ++xcm_bench_allocs; return __libc_calloc( n, size ); }
+void *       realloc                 ( void              * ptr,
+                                       size_t              size )
+{ ++xcm_bench_allocs; return __libc_realloc( ptr, size ); }
+#endif
+
+static uint32_t xcm_bench_state = 1;
+static uint32_t    xcmBenchRandom    ( void )
+{
+  /* xorshift32 */
+  uint32_t x = xcm_bench_state;
+  x ^= x << 13;
+  x ^= x >> 17;
+  x ^= x << 5;
+  return xcm_bench_state = x;
+}
+
+static void        xcmBenchText      ( unsigned char     * block,
+                                       int                 type,
+                                       const char        * text )
+{
+  size_t len = strlen( text );
+
+  memset( block, 0, 18 );
+  block[3] = type;
+  memset( &block[5], ' ', 13 );
+  memcpy( &block[5], text, len > 13 ? 13 : len );
+  if(len < 13)
+    block[5 + len] = '\n';
+}
+
+static void        xcmBenchChecksum  ( unsigned char     * block )
+{
+  unsigned char sum = 0;
+  int i;
+  for(i = 0; i < 127; ++i)
+    sum += block[i];
+  block[127] = (unsigned char)(256 - sum);
+}
+
+/* @internal
+ * kind 0: plain, 1: CMD descriptor, 2: Apple quirk, 3: CEA-861 extension */
+static void        xcmBenchEdid      ( unsigned char     * edid,
+                                       int                 kind )
+{
+  static const char * pnp[] = { "ACR", "DEL", "EIZ", "SAM", "NEC", "LEN",
+                                "HWP", "BNQ" };
+  static const char * models[] = { "Display A", "ColorEdge", "U2720Q",
+                                   "SyncMaster", "Studio", "PA272W" };
+  const char * mnf = kind == 2 ? "APP" : pnp[xcmBenchRandom() % 8];
+  unsigned v = ((mnf[0] - '@') << 10) | ((mnf[1] - '@') << 5) |
+               (mnf[2] - '@');
+  char serial[16];
+  int i;
+
+  memset( edid, 0, XCM_BENCH_EDID_SIZE );
+  memcpy( edid, "\000\377\377\377\377\377\377\000", 8 );
+  edid[8] = v >> 8;
+  edid[9] = v & 0xff;
+  edid[10] = xcmBenchRandom();
+  edid[11] = xcmBenchRandom();
+  for(i = 12; i < 16; ++i)
+    edid[i] = xcmBenchRandom();
+  edid[16] = 1 + xcmBenchRandom() % 52;
+  edid[17] = 10 + xcmBenchRandom() % 30;
+  edid[18] = 1;
+  edid[19] = 4;
+  edid[23] = 100 + xcmBenchRandom() % 120;                 /* gamma */
+  for(i = 25; i < 35; ++i)                                 /* chromaticity */
+    edid[i] = xcmBenchRandom();
+
+  snprintf( serial, sizeof(serial), "S%08u",
+            (unsigned)(xcmBenchRandom() % 100000000) );
+  if(kind == 2)
+  {
+    /* Apple places model and serial into vendor descriptors */
+    xcmBenchText( &edid[54], 254, "Cinema HD" );
+    xcmBenchText( &edid[72], 254, serial );
+    xcmBenchText( &edid[90], 252, "Color LCD" );
+  } else
+  {
+    xcmBenchText( &edid[54], 252, models[xcmBenchRandom() % 6] );
+    xcmBenchText( &edid[72], 255, serial );
+    xcmBenchText( &edid[90], 254, mnf );
+  }
+  memset( &edid[108], 0, 18 );
+  if(kind == 1)
+  {
+    unsigned char * b = &edid[108];
+    b[3] = 249;
+    b[5] = 3;
+    for(i = 0; i < 6; ++i)
+    {
+      unsigned a = 100 + xcmBenchRandom() % 200;
+      b[6 + 2*i] = a >> 8;
+      b[7 + 2*i] = a & 0xff;
+    }
+  } else
+    edid[108 + 3] = 253;
+
+  if(kind == 3)
+  {
+    unsigned char * e = &edid[128];
+    int pos = 4;
+
+    edid[126] = 1;
+    e[0] = 0x02;
+    e[1] = 0x03;
+    /* colorimetry data block: BT.2020 RGB + YCC */
+    e[pos++] = (7 << 5) | 3;
+    e[pos++] = 0x05;
+    e[pos++] = 0xc0;
+    e[pos++] = 0x00;
+    /* HDR static metadata data block: SDR, PQ, HLG */
+    e[pos++] = (7 << 5) | 6;
+    e[pos++] = 0x06;
+    e[pos++] = 0x0d;
+    e[pos++] = 0x01;
+    e[pos++] = 90 + xcmBenchRandom() % 40;
+    e[pos++] = 80 + xcmBenchRandom() % 40;
+    e[pos++] = xcmBenchRandom() % 100;
+    /* video capability data block */
+    e[pos++] = (7 << 5) | 2;
+    e[pos++] = 0x00;
+    e[pos++] = 0x4a;
+    e[2] = pos;
+    xcmBenchChecksum( e );
+  }
+
+  xcmBenchChecksum( edid );
+}
+
+static double      xcmBenchNow       ( void )
+{
+  struct timespec ts;
+  clock_gettime( CLOCK_MONOTONIC, &ts );
+  return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+typedef struct {
+  const char * name;
+  double       ns;
+  long         calls;
+  long         allocs;
+  size_t       bytes;
+} xcmBenchResult_s;
+
+static void        xcmBenchAdd       ( xcmBenchResult_s  * r,
+                                       double              ns,
+                                       long                calls,
+                                       long                allocs,
+                                       size_t              bytes )
+{
+  r->ns += ns;
+  r->calls += calls;
+  r->allocs += allocs;
+  r->bytes += bytes;
+}
+
+#if XCM_HAVE_LINUX
+/* @internal
+ * scan and read simulated buses, one per corpus EDID; results[0] gets
+ * XcmDDClist() and results[1] XcmDDCgetEDID() */
+static long        xcmBenchDDC       ( const unsigned char * corpus,
+                                       int                 buses,
+                                       int                 iterations,
+                                       long                latency_us,
+                                       unsigned            seed,
+                                       xcmBenchResult_s  * results )
+{
+  char dir[] = "/tmp/xcm-bench-XXXXXX", name[64];
+  XcmDDCMockOptions_s options;
+  XcmDDCTransport_s * mock;
+  long errors = 0;
+  int k, it;
+
+  if(!mkdtemp( dir ))
+    return 1;
+  for(k = 0; k < buses; ++k)
+  {
+    const unsigned char * edid = &corpus[(size_t)k * XCM_BENCH_EDID_SIZE];
+    FILE * fp;
+    snprintf( name, sizeof(name), "%s/i2c-%d", dir, k );
+    fp = fopen( name, "wb" );
+    if(!fp || fwrite( edid, 128, 1 + edid[126], fp ) != 1u + edid[126])
+      ++errors;
+    if(fp)
+      fclose( fp );
+  }
+
+  memset( &options, 0, sizeof(options) );
+  options.latency_us = latency_us;
+  options.seed = seed;
+  mock = XcmDDCTransportMockNew( dir, &options );
+  if(!mock)
+    ++errors;
+  else
+    XcmDDCSetTransport( mock );
+
+  for(it = 0; it < iterations && mock; ++it)
+  {
+    char ** list = NULL;
+    int count = 0;
+    size_t bytes = 0;
+    double t;
+    long a;
+
+    a = xcm_bench_allocs;
+    t = xcmBenchNow();
+    if(XcmDDClist( &list, &count ) || count != buses)
+      ++errors;
+    xcmBenchAdd( &results[0], xcmBenchNow() - t, 1, xcm_bench_allocs - a,
+                 0 );
+
+    a = xcm_bench_allocs;
+    t = xcmBenchNow();
+    for(k = 0; k < count; ++k)
+    {
+      char * data = NULL;
+      size_t size = 0;
+      if(XcmDDCgetEDID( list[k], &data, &size ))
+        ++errors;
+      bytes += size;
+      free( data );
+    }
+    xcmBenchAdd( &results[1], xcmBenchNow() - t, count,
+                 xcm_bench_allocs - a, bytes );
+
+    for(k = 0; k < count; ++k)
+      free( list[k] );
+    free( list );
+  }
+
+  XcmDDCSetTransport( NULL );
+  XcmDDCPoolClear();
+  XcmDDCTransportMockFree( &mock );
+  for(k = 0; k < buses; ++k)
+  {
+    snprintf( name, sizeof(name), "%s/i2c-%d", dir, k );
+    remove( name );
+  }
+  rmdir( dir );
+
+  return errors;
+}
+#endif
+
+int main(int argc, char ** argv)
+{
+  int n = 1024, iterations = 200, json = 0, buses = 0, n_results = 4, i, k,
+      it;
+  unsigned seed = 1;
+  long latency_us = 0;
+  unsigned char * corpus;
+  XcmEdidKeyValue_s ** lists;
+  xcmBenchResult_s results[XCM_BENCH_RESULTS] = {
+    { "XcmEdidParse", 0, 0, 0, 0 },
+    { "XcmEdidFree", 0, 0, 0, 0 },
+    { "XcmEdidPrintString", 0, 0, 0, 0 },
+    { "XcmEdidPrintOpenIccJSON", 0, 0, 0, 0 },
+    { "XcmDDClist", 0, 0, 0, 0 },
+    { "XcmDDCgetEDID", 0, 0, 0, 0 } };
+  long errors = 0;
+
+  for(i = 1; i < argc; ++i)
+  {
+    if(strcmp( argv[i], "-j" ) == 0 || strcmp( argv[i], "--json" ) == 0)
+      json = 1;
+    else if(strcmp( argv[i], "-n" ) == 0 && i + 1 < argc)
+      n = atoi( argv[++i] );
+    else if(strcmp( argv[i], "-i" ) == 0 && i + 1 < argc)
+      iterations = atoi( argv[++i] );
+    else if(strcmp( argv[i], "-s" ) == 0 && i + 1 < argc)
+      seed = (unsigned) strtoul( argv[++i], NULL, 0 );
+#if XCM_HAVE_LINUX
+    else if(strcmp( argv[i], "-d" ) == 0 && i + 1 < argc)
+      buses = atoi( argv[++i] );
+    else if(strcmp( argv[i], "-l" ) == 0 && i + 1 < argc)
+      latency_us = atol( argv[++i] );
+#endif
+    else
+    {
+      fprintf( stderr, "Usage: %s [-n corpus_size] [-i iterations] [-s seed] "
+#if XCM_HAVE_LINUX
+               "[-d buses] [-l latency_us] "
+#endif
+               "[-j]\n", argv[0] );
+      return 1;
+    }
+  }
+  if(n < 1 || iterations < 1 || buses < 0 || buses > n)
+    return 1;
+
+  xcm_bench_state = seed ? seed : 1;
+  corpus = malloc( (size_t)n * XCM_BENCH_EDID_SIZE );
+  lists = calloc( n, sizeof(XcmEdidKeyValue_s*) );
+  if(!corpus || !lists)
+    return 1;
+  for(k = 0; k < n; ++k)
+    xcmBenchEdid( &corpus[(size_t)k * XCM_BENCH_EDID_SIZE], k % 4 );
+
+  for(it = 0; it < iterations; ++it)
+  {
+    double t;
+    long a;
+
+    a = xcm_bench_allocs;
+    t = xcmBenchNow();
+    for(k = 0; k < n; ++k)
+    {
+      int count = 0;
+      if(XcmEdidParse( &corpus[(size_t)k * XCM_BENCH_EDID_SIZE], &lists[k],
+                       &count ))
+        ++errors;
+    }
+    /* XcmEdidParse() reads the base block only */
+    xcmBenchAdd( &results[0], xcmBenchNow() - t, n, xcm_bench_allocs - a,
+                 (size_t)n * 128 );
+
+    a = xcm_bench_allocs;
+    t = xcmBenchNow();
+    for(k = 0; k < n; ++k)
+      XcmEdidFree( &lists[k] );
+    xcmBenchAdd( &results[1], xcmBenchNow() - t, n, xcm_bench_allocs - a,
+                 0 );
+
+    for(i = 0; i < 2; ++i)
+    {
+      size_t bytes = 0;
+      a = xcm_bench_allocs;
+      t = xcmBenchNow();
+      for(k = 0; k < n; ++k)
+      {
+        char * text = NULL;
+        void * edid = &corpus[(size_t)k * XCM_BENCH_EDID_SIZE];
+        XCM_EDID_ERROR_e err = i == 0 ?
+                               XcmEdidPrintString( edid, &text, malloc ) :
+                               XcmEdidPrintOpenIccJSON( edid, &text, malloc );
+        if(err)
+          ++errors;
+        if(text)
+          bytes += strlen( text );
+        free( text );
+      }
+      xcmBenchAdd( &results[2 + i], xcmBenchNow() - t, n,
+                   xcm_bench_allocs - a, bytes );
+    }
+  }
+
+#if XCM_HAVE_LINUX
+  if(buses)
+  {
+    errors += xcmBenchDDC( corpus, buses, iterations, latency_us, seed,
+                           &results[4] );
+    n_results = 6;
+  }
+#endif
+
+  if(json)
+  {
+    printf( "{\n  \"version\": \"%d.%d.%d\",\n  \"corpus\": %d,\n"
+            "  \"iterations\": %d,\n  \"seed\": %u,\n  \"buses\": %d,\n"
+            "  \"latency_us\": %ld,\n  \"errors\": %ld,\n"
+            "  \"results\": [\n",
+            XCM_VERSION_MAJOR, XCM_VERSION_MINOR, XCM_VERSION_MICRO,
+            n, iterations, seed, buses, latency_us, errors );
+    for(i = 0; i < n_results; ++i)
+    {
+      xcmBenchResult_s * r = &results[i];
+#ifdef XCM_BENCH_COUNT_ALLOCS
+      double allocs = (double)r->allocs / r->calls;
+#else
+      double allocs = -1;
+#endif
+      printf( "    { \"name\": \"%s\", \"ns_per_op\": %.1f, "
+              "\"allocs_per_op\": %.2f, \"ops_per_s\": %.0f, "
+              "\"mb_per_s\": %.2f }%s\n",
+              r->name, r->ns / r->calls, allocs, r->calls / r->ns * 1e9,
+              r->bytes / r->ns * 1e3, i < n_results - 1 ? "," : "" );
+    }
+    printf( "  ]\n}\n" );
+  } else
+  {
+    printf( "libXcm %d.%d.%d  corpus %d EDIDs  %d iterations  seed %u",
+            XCM_VERSION_MAJOR, XCM_VERSION_MINOR, XCM_VERSION_MICRO,
+            n, iterations, seed );
+    if(buses)
+      printf( "  %d buses  %ld us latency", buses, latency_us );
+    printf( "\n" );
+    printf( "%-24s %12s %12s %14s %10s\n",
+            "function", "ns/op", "allocs/op", "ops/s", "MB/s" );
+    for(i = 0; i < n_results; ++i)
+    {
+      xcmBenchResult_s * r = &results[i];
+#ifdef XCM_BENCH_COUNT_ALLOCS
+      double allocs = (double)r->allocs / r->calls;
+#else
+      double allocs = -1;
+#endif
+      printf( "%-24s %12.1f %12.2f %14.0f %10.2f\n",
+              r->name, r->ns / r->calls, allocs, r->calls / r->ns * 1e9,
+              r->bytes / r->ns * 1e3 );
+    }
+    if(errors)
+      printf( "errors: %ld\n", errors );
+  }
+
+  free( lists );
+  free( corpus );
+
+  return errors ? 1 : 0;
+}
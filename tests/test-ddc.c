@@ -0,0 +1,791 @@
+/*  @file test-ddc.c
+ *
+ *  libXcm  Xorg Colour Management
+ *
+ *  @par Copyright:
+ *            2026 (C) Kai-Uwe Behrmann
+ *
+ *  @brief    DDC unit tests
+ *  @internal
+ *  @author   Kai-Uwe Behrmann <ku.b@gmx.de>
+ *  @par License:
+ *            MIT <http://www.opensource.org/licenses/mit-license.php>
+ *  @since    2026/10/17
+ *
+ *  The test includes the sources to reach internal helpers. Sysfs and
+ *  the i2c buses are replaced by fixtures below the working directory.
+ */
+
+#define _GNU_SOURCE       /* struct ucred */
+#include <sys/types.h>    /* uid_t */
+#include <sys/socket.h>   /* recvmsg() */
+#include <errno.h>
+
+/* uevents of the test come from its own user; recvmsg() can report a
+ * overrun */
+static uid_t xcm_test_uid = 0;
+static int xcm_test_overrun = 0;
+static ssize_t     xcmTestRecvmsg    ( int                 fd,
+                                       struct msghdr     * msg,
+                                       int                 flags );
+
+#define XCM_DDC_SYSFS_DRM "xcm-test-drm/"
+#define XCM_DDC_UEVENT_UID xcm_test_uid
+#define XCM_TEST_I2C "xcm-test-i2c"
+#define recvmsg xcmTestRecvmsg
+
+#include "XcmDDC.c"
+#include "XcmDDCMock.c"
+#include "xcm-test.h"
+
+#include <sys/stat.h>     /* mkdir() */
+
+#undef recvmsg
+static ssize_t     xcmTestRecvmsg    ( int                 fd,
+                                       struct msghdr     * msg,
+                                       int                 flags )
+{
+  if(xcm_test_overrun)
+  {
+    xcm_test_overrun = 0;
+    errno = ENOBUFS;
+    return -1;
+  }
+  return recvmsg( fd, msg, flags );
+}
+
+/* fixtures */
+
+static void        xcmTestWrite      ( const char        * dir,
+                                       const char        * file,
+                                       const void        * data,
+                                       size_t              size )
+{
+  char path[512];
+  FILE * fp;
+
+  snprintf( path, sizeof(path), "%s/%s", dir, file );
+  fp = fopen( path, "wb" );
+  XCM_TEST( fp != NULL );
+  if(!fp)
+    return;
+  XCM_TEST( fwrite( data, 1, size, fp ) == size );
+  fclose( fp );
+}
+
+static void        xcmTestRemove     ( const char        * dir )
+{
+  DIR * d = opendir( dir );
+  struct dirent * entry;
+  char path[512];
+
+  while(d && (entry = readdir( d )) != NULL)
+  {
+    struct stat st;
+    if(entry->d_name[0] == '.')
+      continue;
+    snprintf( path, sizeof(path), "%s/%s", dir, entry->d_name );
+    if(lstat( path, &st ) == 0 && S_ISDIR( st.st_mode ))
+      xcmTestRemove( path );
+    else
+      unlink( path );
+  }
+  if(d)
+    closedir( d );
+  rmdir( dir );
+}
+
+/* a sysfs DRM connector with status, hotplug epoch and EDID */
+static void        xcmTestConnector  ( const char        * name,
+                                       const char        * status,
+                                       int                 epoch )
+{
+  char dir[256], text[32];
+  unsigned char edid[128];
+
+  snprintf( dir, sizeof(dir), XCM_DDC_SYSFS_DRM "%s", name );
+  mkdir( XCM_DDC_SYSFS_DRM, 0755 );
+  mkdir( dir, 0755 );
+
+  snprintf( text, sizeof(text), "%s\n", status );
+  xcmTestWrite( dir, "status", text, strlen( text ) );
+  snprintf( text, sizeof(text), "%d\n", epoch );
+  xcmTestWrite( dir, "epoch", text, strlen( text ) );
+
+  memset( edid, 0, sizeof(edid) );
+  memset( &edid[1], 0xff, 6 );
+  edid[8] = (unsigned char) epoch;
+  xcmTestWrite( dir, "edid", edid,
+                strcmp( status, "connected" ) == 0 ? sizeof(edid) : 0 );
+}
+
+/* one kernel uevent datagram for a DRM card */
+static void        xcmTestUevent     ( int                 fd,
+                                       const char        * card )
+{
+  char msg[512];
+  int len = 0;
+
+  len += sprintf( &msg[len], "change@/devices/pci0000:00/drm/%s", card ) + 1;
+  len += sprintf( &msg[len], "ACTION=change" ) + 1;
+  len += sprintf( &msg[len], "DEVPATH=/devices/pci0000:00/drm/%s", card ) + 1;
+  len += sprintf( &msg[len], "SUBSYSTEM=drm" ) + 1;
+  len += sprintf( &msg[len], "HOTPLUG=1" ) + 1;
+  XCM_TEST( send( fd, msg, len, 0 ) == len );
+}
+
+static int         xcmTestFind       ( const XcmDDCConnector_s * list,
+                                       int                 count,
+                                       const char        * name,
+                                       const char        * status )
+{
+  int i;
+  for(i = 0; i < count; ++i)
+    if(strcmp( list[i].name, name ) == 0)
+      return strcmp( list[i].status, status ) == 0;
+  return 0;
+}
+
+/* several uevents in one XcmDDCHotplugRead() extend the same array over
+ * several scans, including the disconnect path */
+static void        xcmTestHotplug    ( void )
+{
+  static const char * card0[] = { "card0-DP-1", "card0-DP-2", "card0-DP-3",
+                                  "card0-DP-4", "card0-HDMI-A-1" };
+  static const char * card1[] = { "card1-DP-5", "card1-DP-6", "card1-DP-7" };
+  XcmDDCHotplug_s * hp = calloc( 1, sizeof(XcmDDCHotplug_s) );
+  XcmDDCConnector_s * changed = NULL;
+  int fds[2], count = 0, i, on = 1;
+
+  xcmTestRemove( XCM_DDC_SYSFS_DRM );
+  for(i = 0; i < 5; ++i)
+    xcmTestConnector( card0[i], "disconnected", 1 );
+  for(i = 0; i < 3; ++i)
+    xcmTestConnector( card1[i], "disconnected", 1 );
+
+  /* a socket pair stands in for netlink */
+  XCM_TEST( hp != NULL );
+  XCM_TEST( socketpair( AF_UNIX, SOCK_DGRAM | SOCK_NONBLOCK, 0, fds ) == 0 );
+  XCM_TEST( setsockopt( fds[0], SOL_SOCKET, SO_PASSCRED, &on,
+                        sizeof(on) ) == 0 );
+  hp->fd = fds[0];
+  xcm_test_uid = getuid();
+  xcmDDCHotplugScan( hp, NULL, -1, NULL, NULL );
+  XCM_TEST( hp->n == 8 );
+
+  /* nothing changed */
+  xcmTestUevent( fds[1], "card0" );
+  XCM_TEST( XcmDDCHotplugRead( hp, &changed, &count ) == XCM_DDC_OK );
+  XCM_TEST( count == 0 );
+  XcmDDCConnectorListRelease( &changed, count );
+
+  /* card0: four plugged, one unplugged hub port; card1: all plugged */
+  for(i = 0; i < 4; ++i)
+    xcmTestConnector( card0[i], "connected", 2 );
+  xcmTestRemove( XCM_DDC_SYSFS_DRM "card0-HDMI-A-1" );
+  for(i = 0; i < 3; ++i)
+    xcmTestConnector( card1[i], "connected", 2 );
+
+  xcmTestUevent( fds[1], "card0" );
+  xcmTestUevent( fds[1], "card1" );
+  xcmTestUevent( fds[1], "card0" );
+  count = 0;
+  XCM_TEST( XcmDDCHotplugRead( hp, &changed, &count ) == XCM_DDC_OK );
+  XCM_TEST( count == 8 );
+  for(i = 0; i < 4; ++i)
+    XCM_TEST( xcmTestFind( changed, count, card0[i], "connected" ) );
+  XCM_TEST( xcmTestFind( changed, count, card0[4], "disconnected" ) );
+  for(i = 0; i < 3; ++i)
+    XCM_TEST( xcmTestFind( changed, count, card1[i], "connected" ) );
+  for(i = 0; i < count; ++i)
+    if(strcmp( changed[i].status, "connected" ) == 0)
+      XCM_TEST( changed[i].edid && changed[i].edid_size == 128 &&
+                changed[i].sysfs );
+  XcmDDCConnectorListRelease( &changed, count );
+  XCM_TEST( hp->n == 7 );
+
+  /* a uevent from a other user is ignored */
+  xcmTestConnector( card0[0], "disconnected", 3 );
+  xcm_test_uid = getuid() + 1;
+  xcmTestUevent( fds[1], "card0" );
+  count = 0;
+  XCM_TEST( XcmDDCHotplugRead( hp, &changed, &count ) == XCM_DDC_OK );
+  XCM_TEST( count == 0 );
+  XcmDDCConnectorListRelease( &changed, count );
+  xcm_test_uid = getuid();
+
+  /* after a overrun the lost uevent of card0 is caught up with */
+  xcmTestConnector( card1[0], "disconnected", 3 );
+  xcm_test_overrun = 1;
+  xcmTestUevent( fds[1], "card1" );
+  count = 0;
+  XCM_TEST( XcmDDCHotplugRead( hp, &changed, &count ) == XCM_DDC_OK );
+  XCM_TEST( count == 2 );
+  XCM_TEST( xcmTestFind( changed, count, card0[0], "disconnected" ) );
+  XCM_TEST( xcmTestFind( changed, count, card1[0], "disconnected" ) );
+  XcmDDCConnectorListRelease( &changed, count );
+
+  close( fds[1] );
+  XcmDDCHotplugRelease( &hp );
+  xcmTestRemove( XCM_DDC_SYSFS_DRM );
+}
+
+/* a E-EDID of 128 byte blocks; the extensions carry their block number */
+static void        xcmTestEdid       ( unsigned char     * edid,
+                                       int                 blocks,
+                                       int                 serial )
+{
+  int i, j;
+
+  memset( edid, 0, blocks * 128 );
+  memcpy( edid, "\000\377\377\377\377\377\377\000", 8 );
+  edid[12] = serial;
+  edid[126] = blocks - 1;
+  for(i = 1; i < blocks; ++i)
+  {
+    edid[i * 128] = 0x70;
+    for(j = 1; j < 127; ++j)
+      edid[i * 128 + j] = i;
+  }
+  for(i = 0; i < blocks; ++i)
+  {
+    unsigned char sum = 0;
+    for(j = 0; j < 127; ++j)
+      sum += edid[i * 128 + j];
+    edid[i * 128 + 127] = 256 - sum;
+  }
+}
+
+/* mock buses: i2c-0 without monitor, i2c-1 with a 384 byte E-EDID,
+ * i2c-2 with a base block and i2c-3 with one extension */
+static unsigned char xcm_test_edid[4][384];
+static const int xcm_test_blocks[4] = { 0, 3, 1, 2 };
+
+static void        xcmTestBuses      ( void )
+{
+  char name[16];
+  int i;
+
+  xcmTestRemove( XCM_TEST_I2C );
+  mkdir( XCM_TEST_I2C, 0755 );
+  for(i = 0; i < 4; ++i)
+  {
+    if(xcm_test_blocks[i])
+      xcmTestEdid( xcm_test_edid[i], xcm_test_blocks[i], i );
+    snprintf( name, sizeof(name), "i2c-%d", i );
+    xcmTestWrite( XCM_TEST_I2C, name, xcm_test_edid[i],
+                  xcm_test_blocks[i] * 128 );
+  }
+}
+
+static XcmDDCTransport_s * xcmTestMock( const XcmDDCMockOptions_s * options )
+{
+  XcmDDCTransport_s * mock = XcmDDCTransportMockNew( XCM_TEST_I2C,
+                                                     options );
+  XCM_TEST( mock != NULL );
+  XcmDDCSetTransport( mock );
+  return mock;
+}
+
+static void        xcmTestMockFree   ( XcmDDCTransport_s ** mock )
+{
+  XcmDDCSetTransport( NULL );
+  XcmDDCPoolClear();
+  XcmDDCTransportMockFree( mock );
+}
+
+/* read with a private handle and compare to the file */
+static XCM_DDC_ERROR_e xcmTestRead   ( int                 bus,
+                                       XCM_DDC_MODE_e      mode,
+                                       size_t              size,
+                                       unsigned long     * backoffs )
+{
+  XcmDDCDevice_s * dev = NULL;
+  XCM_DDC_ERROR_e error;
+  char name[64], * data = NULL;
+  size_t n = 0;
+
+  snprintf( name, sizeof(name), XCM_TEST_I2C "/i2c-%d", bus );
+  error = XcmDDCDeviceOpen( name, &dev );
+  XCM_TEST( error == XCM_DDC_OK );
+  if(error)
+    return error;
+
+  error = XcmDDCDeviceGetEDID( dev, &data, &n );
+  if(error == XCM_DDC_OK)
+  {
+    XCM_TEST( n == size );
+    XCM_TEST( memcmp( data, xcm_test_edid[bus], size ) == 0 );
+    XCM_TEST( XcmDDCDeviceMode( dev, NULL ) == mode );
+  }
+  if(backoffs)
+    XcmDDCDeviceTiming( dev, NULL, backoffs );
+  free( data );
+  XcmDDCDeviceRelease( &dev );
+
+  return error;
+}
+
+/* the complete E-EDID; the third block needs the segment pointer */
+static void        xcmTestMockEdid   ( void )
+{
+  XcmDDCTransport_s * mock;
+  XcmDDCDevice_s * dev = NULL;
+  char * data = NULL;
+  size_t size = 0;
+
+  xcmTestBuses();
+  mock = xcmTestMock( NULL );
+
+  XCM_TEST( XcmDDCgetEDID( XCM_TEST_I2C "/i2c-1", &data, &size ) ==
+            XCM_DDC_OK );
+  XCM_TEST( size == 384 && memcmp( data, xcm_test_edid[1], 384 ) == 0 );
+  free( data );
+  XCM_TEST( xcmTestRead( 3, XCM_DDC_MODE_I2C_RDWR, 256, NULL ) ==
+            XCM_DDC_OK );
+  XCM_TEST( xcmTestRead( 1, XCM_DDC_MODE_I2C_RDWR, 384, NULL ) ==
+            XCM_DDC_OK );
+
+  data = NULL;
+  XCM_TEST( XcmDDCgetEDID( XCM_TEST_I2C "/i2c-0", &data, &size ) !=
+            XCM_DDC_OK );
+  free( data );
+
+  /* only the monitor stays open */
+  dev = xcmDDCPoolFind( XCM_TEST_I2C "/i2c-1" );
+  XCM_TEST( dev != NULL );
+  XcmDDCDeviceRelease( &dev );
+  dev = xcmDDCPoolFind( XCM_TEST_I2C "/i2c-0" );
+  XCM_TEST( dev == NULL );
+  XcmDDCDeviceRelease( &dev );
+
+  xcmTestMockFree( &mock );
+  xcmTestRemove( XCM_TEST_I2C );
+}
+
+/* a adapter announces all transfers and rejects the combined ones or
+ * both; without the segment pointer the read ends after 256 bytes */
+static void        xcmTestMockFallback(void )
+{
+  XcmDDCMockOptions_s options;
+  XcmDDCTransport_s * mock;
+
+  xcmTestBuses();
+  memset( &options, 0, sizeof(options) );
+  options.announce = XCM_DDC_FUNC_I2C | XCM_DDC_FUNC_SMBUS_READ_BLOCK;
+
+  options.funcs = XCM_DDC_FUNC_I2C;
+  mock = xcmTestMock( &options );
+  XCM_TEST( xcmTestRead( 1, XCM_DDC_MODE_I2C_RDWR, 384, NULL ) ==
+            XCM_DDC_OK );
+  xcmTestMockFree( &mock );
+
+  options.funcs = XCM_DDC_FUNC_SMBUS_READ_BLOCK;
+  mock = xcmTestMock( &options );
+  XCM_TEST( xcmTestRead( 1, XCM_DDC_MODE_SMBUS, 256, NULL ) ==
+            XCM_DDC_OK );
+  xcmTestMockFree( &mock );
+
+  options.funcs = XCM_DDC_FUNC_PLAIN;
+  mock = xcmTestMock( &options );
+  XCM_TEST( xcmTestRead( 1, XCM_DDC_MODE_LEGACY, 256, NULL ) ==
+            XCM_DDC_OK );
+  XCM_TEST( xcmTestRead( 2, XCM_DDC_MODE_LEGACY, 128, NULL ) ==
+            XCM_DDC_OK );
+  xcmTestMockFree( &mock );
+
+  xcmTestRemove( XCM_TEST_I2C );
+}
+
+/* legacy transfers repeat a NAKed block with a longer delay; a NAK of
+ * the very first write still counts as a empty bus */
+static void        xcmTestMockNak    ( void )
+{
+  XcmDDCMockOptions_s options;
+  XcmDDCTransport_s * mock;
+  int retried = 0;
+
+  xcmTestBuses();
+  memset( &options, 0, sizeof(options) );
+  options.funcs = XCM_DDC_FUNC_PLAIN;
+  options.nak_percent = 25;
+
+  for(options.seed = 1; options.seed <= 8; ++options.seed)
+  {
+    unsigned long backoffs = 0;
+    XCM_DDC_ERROR_e error;
+
+    mock = xcmTestMock( &options );
+    error = xcmTestRead( 3, XCM_DDC_MODE_LEGACY, 256, &backoffs );
+    XCM_TEST( error == XCM_DDC_OK || error == XCM_DDC_PREPARE_FAIL );
+    if(error == XCM_DDC_OK && backoffs)
+      ++retried;
+    xcmTestMockFree( &mock );
+  }
+  XCM_TEST( retried > 0 );
+
+  xcmTestRemove( XCM_TEST_I2C );
+}
+
+/* a monitor, which needs 30 ms between accesses, NAKs the first offset
+ * writes; the delay is learned and a empty bus is still given up */
+static void        xcmTestMockSettle ( void )
+{
+  XcmDDCMockOptions_s options;
+  XcmDDCTransport_s * mock;
+  unsigned long backoffs = 0;
+  XcmDDCDevice_s * dev = NULL;
+  long delay_us = 0;
+
+  xcmTestBuses();
+  memset( &options, 0, sizeof(options) );
+  options.funcs = XCM_DDC_FUNC_PLAIN;
+  options.settle_us = 30000;
+  mock = xcmTestMock( &options );
+
+  XCM_TEST( xcmTestRead( 2, XCM_DDC_MODE_LEGACY, 128, &backoffs ) ==
+            XCM_DDC_OK );
+  XCM_TEST( backoffs > 0 );
+
+  /* the next handle starts with the learned delay */
+  backoffs = 0;
+  XCM_TEST( xcmTestRead( 2, XCM_DDC_MODE_LEGACY, 128, &backoffs ) ==
+            XCM_DDC_OK );
+  XCM_TEST( backoffs == 0 );
+  XCM_TEST( XcmDDCDeviceOpen( XCM_TEST_I2C "/i2c-2", &dev ) == XCM_DDC_OK );
+  XcmDDCDeviceTiming( dev, &delay_us, NULL );
+  XCM_TEST( delay_us >= options.settle_us );
+  XcmDDCDeviceRelease( &dev );
+
+  XCM_TEST( xcmTestRead( 0, XCM_DDC_MODE_LEGACY, 0, NULL ) ==
+            XCM_DDC_PREPARE_FAIL );
+
+  xcmTestMockFree( &mock );
+  xcmTestRemove( XCM_TEST_I2C );
+}
+
+/* the deadline ends running reads as well; a empty legacy bus alone
+ * takes 155 ms to give up and monitors, which need 150 ms, even longer */
+static void        xcmTestMockDeadline(void )
+{
+  XcmDDCMockOptions_s options;
+  XcmDDCTransport_s * mock;
+  int threads;
+
+  xcmTestBuses();
+  memset( &options, 0, sizeof(options) );
+  options.funcs = XCM_DDC_FUNC_PLAIN;
+  options.settle_us = 150000;
+
+  for(threads = 1; threads <= 4; threads += 3)
+  {
+    char ** list = NULL;
+    int count = -1;
+    struct timespec start, end;
+    long ms;
+
+    mock = xcmTestMock( &options );
+    clock_gettime( CLOCK_MONOTONIC, &start );
+    XCM_TEST( XcmDDClistParallel( &list, &count, threads, 50 ) ==
+              XCM_DDC_TIMEOUT );
+    clock_gettime( CLOCK_MONOTONIC, &end );
+    ms = (end.tv_sec - start.tv_sec) * 1000 +
+         (end.tv_nsec - start.tv_nsec) / 1000000;
+    XCM_TEST( count == 0 && list == NULL );
+    XCM_TEST( ms >= 50 && ms < 120 );
+    xcmTestMockFree( &mock );
+  }
+
+  xcmTestRemove( XCM_TEST_I2C );
+}
+
+/* only buses with a monitor, in bus order */
+static void        xcmTestMockList   ( void )
+{
+  XcmDDCTransport_s * mock;
+  char ** list = NULL;
+  int count = 0, i;
+
+  xcmTestBuses();
+  mock = xcmTestMock( NULL );
+
+  XCM_TEST( XcmDDClist( &list, &count ) == XCM_DDC_OK );
+  XCM_TEST( count == 3 );
+  for(i = 0; i < count; ++i)
+  {
+    char name[64];
+    snprintf( name, sizeof(name), XCM_TEST_I2C "/i2c-%d", i + 1 );
+    XCM_TEST( strcmp( list[i], name ) == 0 );
+    free( list[i] );
+  }
+  free( list );
+
+  xcmTestMockFree( &mock );
+  xcmTestRemove( XCM_TEST_I2C );
+}
+
+/* a DDC/CI monitor on top of the mock bus: it keeps the last request
+ * and answers with a prepared reply */
+typedef struct {
+  const XcmDDCTransport_s * mock;
+  int                slave;
+  unsigned char      request[40];
+  int                request_len;
+  int                requests;
+  unsigned char      reply[40];
+  int                reply_len;
+  int                reads;
+  int                corrupt;          /* flip the checksum */
+  const char       * caps;             /* capabilities string */
+} xcmTestCI_s;
+static xcmTestCI_s xcm_test_ci;
+
+static int         xcmTestCIAddress  ( void              * handle,
+                                       int                 address,
+                                       int                 force )
+{
+  xcm_test_ci.slave = address;
+  return xcm_test_ci.mock->address( handle, address, force );
+}
+
+static int         xcmTestCIRead     ( void              * handle,
+                                       unsigned char     * buf,
+                                       int                 len )
+{
+  if(xcm_test_ci.slave != XCM_DDC_CI_ADDRESS)
+    return xcm_test_ci.mock->read( handle, buf, len );
+  ++xcm_test_ci.reads;
+  memset( buf, 0, len );
+  memcpy( buf, xcm_test_ci.reply,
+          len < xcm_test_ci.reply_len ? len : xcm_test_ci.reply_len );
+  return len;
+}
+
+static void        xcmTestCIReply    ( const unsigned char * payload,
+                                       int                 len );
+
+static int         xcmTestCIWrite    ( void              * handle,
+                                       const unsigned char * buf,
+                                       int                 len )
+{
+  if(xcm_test_ci.slave != XCM_DDC_CI_ADDRESS)
+    return xcm_test_ci.mock->write( handle, buf, len );
+  if(len > (int)sizeof(xcm_test_ci.request))
+    return -1;
+  memcpy( xcm_test_ci.request, buf, len );
+  xcm_test_ci.request_len = len;
+  ++xcm_test_ci.requests;
+
+  /* capabilities request: answer 32 bytes from the offset */
+  if(xcm_test_ci.caps && len == 6 && buf[2] == 0xf3)
+  {
+    int offset = buf[3] << 8 | buf[4],
+        n = (int)strlen( xcm_test_ci.caps ) - offset;
+    unsigned char r[3 + 32];
+
+    if(n < 0)
+      n = 0;
+    if(n > 32)
+      n = 32;
+    r[0] = 0xe3;
+    r[1] = buf[3];
+    r[2] = buf[4];
+    memcpy( &r[3], xcm_test_ci.caps + offset, n );
+    xcmTestCIReply( r, 3 + n );
+  }
+
+  return len;
+}
+
+/* frame a reply: destination, length, payload and checksum */
+static void        xcmTestCIReply    ( const unsigned char * payload,
+                                       int                 len )
+{
+  unsigned char * r = xcm_test_ci.reply;
+  unsigned char chk = XCM_DDC_CI_REPLY_XOR;
+  int i;
+
+  r[0] = XCM_DDC_CI_DEST;
+  r[1] = 0x80 | len;
+  memcpy( &r[2], payload, len );
+  for(i = 0; i < 2 + len; ++i)
+    chk ^= r[i];
+  r[2 + len] = chk ^ (xcm_test_ci.corrupt ? 1 : 0);
+  xcm_test_ci.reply_len = 3 + len;
+}
+
+/* the mock bus i2c-2 with the DDC/CI monitor; returns a opened device */
+static XcmDDCDevice_s * xcmTestCIOpen( XcmDDCTransport_s ** mock,
+                                       XcmDDCTransport_s * ci )
+{
+  XcmDDCDevice_s * dev = NULL;
+
+  xcmTestBuses();
+  *mock = XcmDDCTransportMockNew( XCM_TEST_I2C, NULL );
+  XCM_TEST( *mock != NULL );
+  memset( &xcm_test_ci, 0, sizeof(xcm_test_ci) );
+  xcm_test_ci.mock = *mock;
+  *ci = **mock;
+  ci->address = xcmTestCIAddress;
+  ci->write = xcmTestCIWrite;
+  ci->read = xcmTestCIRead;
+  XcmDDCSetTransport( ci );
+
+  XCM_TEST( XcmDDCDeviceOpen( XCM_TEST_I2C "/i2c-2", &dev ) == XCM_DDC_OK );
+  return dev;
+}
+
+static void        xcmTestCIClose    ( XcmDDCTransport_s ** mock,
+                                       XcmDDCDevice_s   ** dev )
+{
+  XcmDDCDeviceRelease( dev );
+  xcmTestMockFree( mock );
+  xcmTestRemove( XCM_TEST_I2C );
+}
+
+/* MCCS get and set requests and replies with their checksums */
+static void        xcmTestCIVCP      ( void )
+{
+  static const unsigned char set[] = { 0x51, 0x84, 0x03, 0x10, 0x12, 0x34,
+                                       0x6e ^ 0x51 ^ 0x84 ^ 0x03 ^ 0x10 ^
+                                       0x12 ^ 0x34 },
+                             get[] = { 0x51, 0x82, 0x01, 0x10,
+                                       0x6e ^ 0x51 ^ 0x82 ^ 0x01 ^ 0x10 },
+                             reply[] = { 0x02, 0x00, 0x10, 0x00, 0x00, 0x64,
+                                         0x00, 0x32 };
+  XcmDDCTransport_s * mock = NULL, ci;
+  XcmDDCDevice_s * dev = xcmTestCIOpen( &mock, &ci );
+  unsigned char r[8];
+  int value = 0, max = 0;
+
+  XCM_TEST( XcmDDCSetVCP( dev, 0x10, 0x1234 ) == XCM_DDC_OK );
+  XCM_TEST( xcm_test_ci.request_len == sizeof(set) &&
+            memcmp( xcm_test_ci.request, set, sizeof(set) ) == 0 );
+
+  xcmTestCIReply( reply, sizeof(reply) );
+  XCM_TEST( XcmDDCGetVCP( dev, 0x10, &value, &max ) == XCM_DDC_OK );
+  XCM_TEST( xcm_test_ci.request_len == sizeof(get) &&
+            memcmp( xcm_test_ci.request, get, sizeof(get) ) == 0 );
+  XCM_TEST( value == 0x32 && max == 0x64 );
+
+  /* a bad checksum is retried and then reported */
+  xcm_test_ci.corrupt = 1;
+  xcmTestCIReply( reply, sizeof(reply) );
+  xcm_test_ci.reads = 0;
+  XCM_TEST( XcmDDCGetVCP( dev, 0x10, &value, NULL ) == XCM_DDC_CHECKSUM );
+  XCM_TEST( xcm_test_ci.reads == XCM_DDC_VCP_RETRIES );
+  xcm_test_ci.corrupt = 0;
+
+  /* the display does not know the code */
+  memcpy( r, reply, sizeof(r) );
+  r[1] = 0x01;
+  xcmTestCIReply( r, sizeof(r) );
+  XCM_TEST( XcmDDCGetVCP( dev, 0x10, &value, NULL ) ==
+            XCM_DDC_VCP_UNSUPPORTED );
+
+  /* a reply for another code or from another source */
+  r[1] = 0x00;
+  r[2] = 0x12;
+  xcmTestCIReply( r, sizeof(r) );
+  XCM_TEST( XcmDDCGetVCP( dev, 0x10, &value, NULL ) == XCM_DDC_WRONG_REPLY );
+  xcmTestCIReply( reply, sizeof(reply) );
+  xcm_test_ci.reply[0] = 0x6f;
+  XCM_TEST( XcmDDCGetVCP( dev, 0x10, &value, NULL ) == XCM_DDC_WRONG_REPLY );
+
+  xcmTestCIClose( &mock, &dev );
+}
+
+/* the VCP table of a capabilities string; codes outside vcp(), in
+ * vcpname() or beyond the string end do not count */
+static void        xcmTestCapsParse  ( void )
+{
+  XcmDDCCaps_s * caps = xcmDDCCapsNew( "(prot(monitor)type(lcd)model(X1)"
+                  "cmds(01 02 03 0C E3 F3)vcp(02 04 10 12 14(05 08 0B) "
+                  "60(0F 11 12) D6(01 04) DF)vcpname(10(Brightness))"
+                  "mswhql(1)mccs_ver(2.1))" );
+  static const unsigned char codes[] = { 0x02, 0x04, 0x10, 0x12, 0x14,
+                                         0x60, 0xd6, 0xdf };
+  int i;
+
+  XCM_TEST( caps != NULL );
+  if(!caps)
+    return;
+  XCM_TEST( caps->n == (int)sizeof(codes) );
+  for(i = 0; i < caps->n && i < (int)sizeof(codes); ++i)
+    XCM_TEST( caps->vcp[i].code == codes[i] );
+  XCM_TEST( caps->vcp[2].n_values == 0 );
+  XCM_TEST( caps->vcp[4].n_values == 3 &&
+            memcmp( caps->vcp[4].values, "\x05\x08\x0b", 3 ) == 0 );
+  XCM_TEST( caps->vcp[5].n_values == 3 &&
+            memcmp( caps->vcp[5].values, "\x0f\x11\x12", 3 ) == 0 );
+  XCM_TEST( caps->vcp[6].n_values == 2 &&
+            memcmp( caps->vcp[6].values, "\x01\x04", 2 ) == 0 );
+  XCM_TEST( strstr( caps->text, "mccs_ver(2.1)" ) != NULL );
+  free( caps );
+
+  /* upper case, without outer brackets and cut off */
+  caps = xcmDDCCapsNew( "VCP(10 12 14(05 08" );
+  XCM_TEST( caps && caps->n == 3 && caps->vcp[2].n_values == 2 );
+  free( caps );
+
+  caps = xcmDDCCapsNew( "(prot(monitor)model(vcp))" );
+  XCM_TEST( caps && caps->n == 0 );
+  free( caps );
+}
+
+/* fragments are reassembled once per monitor; a later process finds
+ * them in the cache file */
+static void        xcmTestCapsCache  ( void )
+{
+  const char * text = "(prot(monitor)type(lcd)model(X1)cmds(01 02 03 0C "
+                      "E3 F3)vcp(02 04 10 12 14(05 08 0B) 16 18 1A 60(0F "
+                      "11 12))mccs_ver(2.1))",
+             * cache = "xcm-test-caps.cache";
+  XcmDDCTransport_s * mock = NULL, ci;
+  XcmDDCDevice_s * dev = xcmTestCIOpen( &mock, &ci );
+  const XcmDDCCaps_s * caps = NULL;
+
+  remove( cache );
+  XcmDDCSetCapabilitiesCache( cache );
+  xcm_test_ci.caps = text;
+
+  XCM_TEST( XcmDDCGetCapabilities( dev, &caps ) == XCM_DDC_OK );
+  XCM_TEST( caps && strcmp( caps->text, text ) == 0 );
+  XCM_TEST( caps && caps->n == 9 );
+  /* one request per 32 bytes and one for the empty end fragment */
+  XCM_TEST( xcm_test_ci.requests == ((int)strlen( text ) + 31) / 32 + 1 );
+
+  xcm_test_ci.requests = 0;
+  XCM_TEST( XcmDDCGetCapabilities( dev, &caps ) == XCM_DDC_OK );
+  XCM_TEST( xcm_test_ci.requests == 0 );
+
+  XcmDDCClearCapabilities();
+  caps = NULL;
+  XCM_TEST( XcmDDCGetCapabilities( dev, &caps ) == XCM_DDC_OK );
+  XCM_TEST( caps && strcmp( caps->text, text ) == 0 );
+  XCM_TEST( xcm_test_ci.requests == 0 );
+
+  XcmDDCSetCapabilitiesCache( NULL );
+  XcmDDCClearCapabilities();
+  remove( cache );
+  xcmTestCIClose( &mock, &dev );
+}
+
+static const xcmTest_s xcm_tests[] = {
+  { "hotplug", xcmTestHotplug },
+  { "mock-edid", xcmTestMockEdid },
+  { "mock-fallback", xcmTestMockFallback },
+  { "mock-nak", xcmTestMockNak },
+  { "mock-settle", xcmTestMockSettle },
+  { "mock-deadline", xcmTestMockDeadline },
+  { "mock-list", xcmTestMockList },
+  { "ci-vcp", xcmTestCIVCP },
+  { "caps-parse", xcmTestCapsParse },
+  { "caps-cache", xcmTestCapsCache },
+  { NULL, NULL }
+};
+
+int main( int argc, char ** argv )
+{
+  return xcmTestMain( xcm_tests, argc, argv );
+}
@@ -0,0 +1,475 @@
+/*  @file test-edid.c
+ *
+ *  libXcm  Xorg Colour Management
+ *
+ *  @par Copyright:
+ *            2026 (C) Kai-Uwe Behrmann
+ *
+ *  @brief    EDID parser and data base unit tests
+ *  @internal
+ *  @author   Kai-Uwe Behrmann <ku.b@gmx.de>
+ *  @par License:
+ *            MIT <http://www.opensource.org/licenses/mit-license.php>
+ *  @since    2026/10/17
+ *
+ *  The EDIDs are composed in place, so each test shows the bytes it
+ *  depends on.
+ */
+
+#include "XcmEdidParse.c"
+#include "XcmEdidDb.c"
+#include "xcm-test.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <sys/mman.h>     /* mmap() */
+#include <unistd.h>       /* sysconf() */
+
+#define XCM_TEST_NEAR( a, b ) (fabs( (a) - (b) ) < 0.001)
+
+/* fixtures */
+
+static void        xcmTestChecksum   ( unsigned char     * block )
+{
+  unsigned char sum = 0;
+  int i;
+  for(i = 0; i < 127; ++i)
+    sum += block[i];
+  block[127] = 256 - sum;
+}
+
+static void        xcmTestText       ( unsigned char     * block,
+                                       int                 type,
+                                       const char        * text )
+{
+  size_t len = strlen( text );
+
+  memset( block, 0, 18 );
+  block[3] = type;
+  memset( &block[5], ' ', 13 );
+  memcpy( &block[5], text, len );
+  if(len < 13)
+    block[5 + len] = '\n';
+}
+
+/* 10 bit chromaticity of one colour; i is 0 for red up to 3 for white;
+ * the two low bits of x and y share bytes 25 and 26 */
+static void        xcmTestXY         ( unsigned char     * edid,
+                                       int                 i,
+                                       int                 x,
+                                       int                 y )
+{
+  int shift = i % 2 ? 0 : 4;
+
+  edid[27 + 2 * i] = x >> 2;
+  edid[28 + 2 * i] = y >> 2;
+  edid[25 + i / 2] |= ((x & 3) << 2 | (y & 3)) << shift;
+}
+
+/* a base block: DEL, model 0x1234, week 10 of 2020, gamma 2.2,
+ * sRGB like primaries, model and serial text */
+static void        xcmTestBase       ( unsigned char     * edid,
+                                       int                 extensions )
+{
+  memset( edid, 0, 128 );
+  memcpy( edid, "\000\377\377\377\377\377\377\000", 8 );
+  edid[8] = ('D' - '@') << 2 | ('E' - '@') >> 3;
+  edid[9] = (('E' - '@') & 7) << 5 | ('L' - '@');
+  edid[10] = 0x34;
+  edid[11] = 0x12;
+  edid[16] = 10;
+  edid[17] = 30;
+  edid[18] = 1;
+  edid[19] = 4;
+  edid[23] = 120;
+  xcmTestXY( edid, 0, 655, 338 );
+  xcmTestXY( edid, 1, 307, 614 );
+  xcmTestXY( edid, 2, 154, 61 );
+  xcmTestXY( edid, 3, 320, 337 );
+  xcmTestText( &edid[54], 252, "Display A" );
+  xcmTestText( &edid[72], 255, "S1234" );
+  edid[108 + 3] = 253;
+  edid[126] = extensions;
+  xcmTestChecksum( edid );
+}
+
+/* a CEA-861 block with colorimetry, HDR static metadata and video
+ * capability data blocks */
+static void        xcmTestCEA        ( unsigned char     * block )
+{
+  int pos = 4;
+
+  memset( block, 0, 128 );
+  block[0] = 0x02;
+  block[1] = 0x03;
+  /* BT.2020 RGB and DCI-P3 */
+  block[pos++] = (7 << 5) | 3;
+  block[pos++] = 0x05;
+  block[pos++] = 0x80;
+  block[pos++] = 0x80;
+  /* SDR and PQ, 400, 200 and 4 cd/m² */
+  block[pos++] = (7 << 5) | 6;
+  block[pos++] = 0x06;
+  block[pos++] = 0x05;
+  block[pos++] = 0x01;
+  block[pos++] = 96;
+  block[pos++] = 64;
+  block[pos++] = 255;
+  block[pos++] = (7 << 5) | 2;
+  block[pos++] = 0x00;
+  block[pos++] = 0x4a;
+  block[2] = pos;
+  xcmTestChecksum( block );
+}
+
+/* IEEE 754 half precision, little endian, for normal values */
+static void        xcmTestHalf       ( unsigned char     * le,
+                                       double              v )
+{
+  int e, m;
+  double f = frexp( v, &e );           /* v = f * 2^e, 0.5 <= f < 1 */
+
+  m = (int)((f * 2.0 - 1.0) * 1024.0 + 0.5);
+  e = e - 1 + 15;
+  le[0] = m & 0xff;
+  le[1] = (e << 2) | (m >> 8);
+}
+
+/* a DisplayID 2.0 section with display parameters: DCI-P3 like
+ * primaries, D65, 600 cd/m² frame-average, 1000 peak, 0.05 minimum and
+ * gamma 2.4; with product identification for a standalone section;
+ * peak_only leaves frame-average and minimum unset */
+static int         xcmTestDisplayID  ( unsigned char     * section,
+                                       int                 standalone,
+                                       int                 peak_only )
+{
+  int pos = 4, i;
+  unsigned char * d, sum = 0;
+
+  memset( section, 0, 126 );
+  section[0] = 0x20;
+  section[2] = 0x01;
+
+  if(standalone)
+  {
+    section[pos++] = 0x20;
+    section[pos++] = 0;
+    section[pos++] = 12 + 5;
+    d = &section[pos];
+    d[3] = 0x78;
+    d[4] = 0x56;
+    d[9] = 20;
+    d[10] = 24;
+    d[11] = 5;
+    memcpy( &d[12], "Panel", 5 );
+    pos += 12 + 5;
+  }
+
+  section[pos++] = 0x21;
+  section[pos++] = 0;
+  section[pos++] = 29;
+  d = &section[pos];
+  /* 12 bit x and y in three bytes */
+#define XCM_TEST_XY( p, x, y ) \
+  (p)[0] = (x) & 0xff; (p)[1] = ((x) >> 8) | (((y) & 15) << 4); \
+  (p)[2] = (y) >> 4;
+  XCM_TEST_XY( &d[9], 2785, 1310 )
+  XCM_TEST_XY( &d[12], 1085, 2826 )
+  XCM_TEST_XY( &d[15], 614, 246 )
+  XCM_TEST_XY( &d[18], 1281, 1348 )
+#undef XCM_TEST_XY
+  xcmTestHalf( &d[23], 1000.0 );
+  if(!peak_only)
+  {
+    xcmTestHalf( &d[21], 600.0 );
+    xcmTestHalf( &d[25], 0.05 );
+  }
+  d[28] = 140;
+  pos += 29;
+
+  section[1] = pos - 4;
+  for(i = 0; i < pos; ++i)
+    sum += section[i];
+  section[pos] = 256 - sum;
+
+  return pos + 1;
+}
+
+/* tests */
+
+static void        xcmTestParseBase  ( void )
+{
+  unsigned char edid[128];
+  XcmEdidKeyValue_s * list = NULL;
+  const XcmEdidKeyValue_s * v;
+  XcmEdidInfo_s info;
+  char * text = NULL;
+  int count = 0;
+
+  xcmTestBase( edid, 0 );
+  XCM_TEST( XcmEdidParse( edid, &list, &count ) == XCM_EDID_OK );
+  XCM_TEST( count > 0 );
+
+  v = XcmEdidGet( list, XCM_EDID_ID_MNFT );
+  XCM_TEST( v && strcmp( v->value.text, "DEL" ) == 0 );
+  v = XcmEdidGet( list, XCM_EDID_ID_MANUFACTURER );
+  XCM_TEST( v && XcmEdidVendorName( 0x10ac ) &&
+            strcmp( v->value.text, XcmEdidVendorName( 0x10ac ) ) == 0 );
+  /* "AAC", the padded ID has a zero inside */
+  XCM_TEST( XcmEdidVendorName( 0x0423 ) != NULL );
+  XCM_TEST( XcmEdidVendorName( 0x009f ) == NULL );
+  v = XcmEdidGet( list, XCM_EDID_ID_MODEL );
+  XCM_TEST( v && strcmp( v->value.text, "Display A" ) == 0 );
+  v = XcmEdidGet( list, XCM_EDID_ID_SERIAL );
+  XCM_TEST( v && strcmp( v->value.text, "S1234" ) == 0 );
+  v = XcmEdidGet( list, XCM_EDID_ID_MODEL_ID );
+  XCM_TEST( v && v->value.integer == 0x1234 );
+  v = XcmEdidGet( list, XCM_EDID_ID_YEAR );
+  XCM_TEST( v && v->value.integer == 2020 );
+  v = XcmEdidGet( list, XCM_EDID_ID_GAMMA );
+  XCM_TEST( v && XCM_TEST_NEAR( v->value.dbl, 2.2 ) );
+  v = XcmEdidGet( list, XCM_EDID_ID_REDx );
+  XCM_TEST( v && XCM_TEST_NEAR( v->value.dbl, 655 / 1024.0 ) );
+  v = XcmEdidGet( list, XCM_EDID_ID_WHITEy );
+  XCM_TEST( v && XCM_TEST_NEAR( v->value.dbl, 337 / 1024.0 ) );
+  XCM_TEST( XcmEdidGet( list, XCM_EDID_ID_VENDOR ) == NULL );
+  XCM_TEST( XcmEdidGet( list, XCM_EDID_ID_EOTF ) == NULL );
+  XcmEdidFree( &list );
+
+  XCM_TEST( XcmEdidParseInto( edid, sizeof(edid), &info ) == XCM_EDID_OK );
+  XCM_TEST( XCM_TEST_NEAR( info.green_y, 614 / 1024.0 ) &&
+            XCM_TEST_NEAR( info.blue_x, 154 / 1024.0 ) );
+  XCM_TEST( info.extensions == 0 && info.week == 10 );
+
+  XCM_TEST( XcmEdidPrintString( edid, &text, malloc ) == XCM_EDID_OK );
+  XCM_TEST( text && strstr( text, "Display A" ) );
+  free( text );
+
+  /* errors */
+  edid[1] = 0;
+  XCM_TEST( XcmEdidParseInto( edid, sizeof(edid), &info ) ==
+            XCM_EDID_WRONG_SIGNATURE );
+  xcmTestBase( edid, 0 );
+  XCM_TEST( XcmEdidParseInto( edid, 100, &info ) == XCM_EDID_WRONG_SIZE );
+  XCM_TEST( XcmEdidParseInto( NULL, 128, &info ) ==
+            XCM_EDID_WRONG_ARGUMENT );
+  XCM_TEST( XcmEdidParseInto( edid, 128, NULL ) == XCM_EDID_WRONG_ARGUMENT );
+}
+
+static void        xcmTestParseCEA   ( void )
+{
+  unsigned char edid[256];
+  XcmEdidKeyValue_s * list = NULL;
+  const XcmEdidKeyValue_s * v;
+  XcmEdidInfo_s info;
+  int count = 0;
+
+  xcmTestBase( edid, 1 );
+  xcmTestCEA( &edid[128] );
+
+  XCM_TEST( XcmEdidParseInto( edid, sizeof(edid), &info ) == XCM_EDID_OK );
+  XCM_TEST( info.extensions == 1 );
+  XCM_TEST( info.eotf == (XCM_EDID_EOTF_SDR | XCM_EDID_EOTF_PQ) );
+  XCM_TEST( info.colorimetry == (XCM_EDID_COLORIMETRY_BT2020RGB |
+                                 XCM_EDID_COLORIMETRY_DCIP3) );
+  XCM_TEST( info.video_capability == 0x4a );
+  XCM_TEST( XCM_TEST_NEAR( info.max_luminance, 400.0 ) );
+  XCM_TEST( XCM_TEST_NEAR( info.max_frame_avg_luminance, 200.0 ) );
+  XCM_TEST( XCM_TEST_NEAR( info.min_luminance, 4.0 ) );
+
+  XCM_TEST( XcmEdidParseSized( edid, sizeof(edid), &list, &count ) ==
+            XCM_EDID_OK );
+  v = XcmEdidGet( list, XCM_EDID_ID_MAX_LUMINANCE );
+  XCM_TEST( v && XCM_TEST_NEAR( v->value.dbl, 400.0 ) );
+  v = XcmEdidGet( list, XCM_EDID_ID_COLORIMETRY );
+  XCM_TEST( v && v->value.integer == info.colorimetry );
+  XcmEdidFree( &list );
+
+  /* without a size only the base block counts */
+  XCM_TEST( XcmEdidParse( edid, &list, &count ) == XCM_EDID_OK );
+  XCM_TEST( XcmEdidGet( list, XCM_EDID_ID_EOTF ) == NULL );
+  XcmEdidFree( &list );
+}
+
+/* DisplayID overrides the base block and the CEA luminance in any
+ * block order; CEA only values stay, as do luminance values, which the
+ * DisplayID block leaves unset */
+static void        xcmTestParseDisplayID ( void )
+{
+  unsigned char edid[384], section[126];
+  XcmEdidInfo_s info;
+  int order, size;
+
+  for(order = 0; order < 4; ++order)
+  {
+    int dpid = order % 2 ? 128 : 256,
+        peak_only = order >= 2;
+
+    xcmTestBase( edid, 2 );
+    xcmTestCEA( &edid[384 - dpid] );
+    memset( &edid[dpid], 0, 128 );
+    edid[dpid] = 0x70;
+    xcmTestDisplayID( &edid[dpid + 1], 0, peak_only );
+    xcmTestChecksum( &edid[dpid] );
+
+    XCM_TEST( XcmEdidParseInto( edid, sizeof(edid), &info ) == XCM_EDID_OK );
+    XCM_TEST( info.extensions == 2 );
+    XCM_TEST( info.flags & XCM_EDID_INFO_DISPLAYID );
+    XCM_TEST( XCM_TEST_NEAR( info.red_x, 2785 / 4096.0 ) &&
+              XCM_TEST_NEAR( info.red_y, 1310 / 4096.0 ) );
+    XCM_TEST( XCM_TEST_NEAR( info.white_x, 1281 / 4096.0 ) &&
+              XCM_TEST_NEAR( info.white_y, 1348 / 4096.0 ) );
+    XCM_TEST( XCM_TEST_NEAR( info.gamma, 2.4 ) );
+    XCM_TEST( XCM_TEST_NEAR( info.max_luminance, 1000.0 ) );
+    XCM_TEST( XCM_TEST_NEAR( info.max_frame_avg_luminance,
+                             peak_only ? 200.0 : 600.0 ) );
+    XCM_TEST( fabs( info.min_luminance - (peak_only ? 4.0 : 0.05) ) <
+              0.0001 );
+    XCM_TEST( info.flags & XCM_EDID_INFO_MAX_FALL &&
+              info.flags & XCM_EDID_INFO_MIN_LUMINANCE );
+    XCM_TEST( info.eotf == (XCM_EDID_EOTF_SDR | XCM_EDID_EOTF_PQ) );
+    XCM_TEST( info.video_capability == 0x4a );
+    /* the base block keeps the product identification */
+    XCM_TEST( strcmp( info.model, "Display A" ) == 0 );
+  }
+
+  /* a standalone structure */
+  size = xcmTestDisplayID( section, 1, 0 );
+  XCM_TEST( XcmEdidParseInto( section, size, &info ) == XCM_EDID_OK );
+  XCM_TEST( strcmp( info.model, "Panel" ) == 0 && info.model_id == 0x5678 );
+  XCM_TEST( info.week == 20 && info.year == 2024 );
+  XCM_TEST( XCM_TEST_NEAR( info.max_luminance, 1000.0 ) );
+  XCM_TEST( XCM_TEST_NEAR( info.blue_x, 614 / 4096.0 ) );
+
+  /* a wrong checksum is no DisplayID */
+  section[size - 1] ^= 1;
+  XCM_TEST( XcmEdidParseInto( section, size, &info ) != XCM_EDID_OK );
+}
+
+/* a base block, which announces two extensions, at the end of a
+ * readable page; any access past 128 bytes faults */
+static void        xcmTestParseTruncated ( void )
+{
+  long page = sysconf( _SC_PAGESIZE );
+  unsigned char * mem = mmap( NULL, 2 * page, PROT_READ | PROT_WRITE,
+                              MAP_PRIVATE | MAP_ANONYMOUS, -1, 0 ),
+                * edid;
+  XcmEdidKeyValue_s * list = NULL;
+  XcmEdidInfo_s info;
+  char * text = NULL;
+  int count = 0;
+
+  XCM_TEST( mem != MAP_FAILED );
+  if(mem == MAP_FAILED)
+    return;
+  XCM_TEST( mprotect( mem + page, page, PROT_NONE ) == 0 );
+  edid = mem + page - 128;
+  xcmTestBase( edid, 2 );
+
+  XCM_TEST( XcmEdidParseInto( edid, 128, &info ) == XCM_EDID_OK );
+  XCM_TEST( info.extensions == 0 );
+  XCM_TEST( XcmEdidParse( edid, &list, &count ) == XCM_EDID_OK );
+  XcmEdidFree( &list );
+  XCM_TEST( XcmEdidParseSized( edid, 128, &list, &count ) == XCM_EDID_OK );
+  XcmEdidFree( &list );
+  XCM_TEST( XcmEdidPrintString( edid, &text, malloc ) == XCM_EDID_OK );
+  free( text );
+  text = NULL;
+  XCM_TEST( XcmEdidPrintOpenIccJSON( edid, &text, malloc ) == XCM_EDID_OK );
+  free( text );
+
+  munmap( mem, 2 * page );
+}
+
+/* parse, write, map and compare all fields */
+static void        xcmTestDbRoundTrip( void )
+{
+  const char * file_name = "xcm-test-edid.db";
+  unsigned char edid[3][384];
+  size_t size[3] = { 128, 256, 384 };
+  XcmEdidInfo_s info[3], back;
+  XcmEdidDbWriter_s * w = XcmEdidDbWriter_New();
+  XcmEdidDb_s * db = NULL;
+  const XcmEdidRecord_s * r;
+  FILE * fp;
+  int i;
+
+  xcmTestBase( edid[0], 0 );
+  xcmTestBase( edid[1], 1 );
+  xcmTestCEA( &edid[1][128] );
+  xcmTestBase( edid[2], 2 );
+  xcmTestCEA( &edid[2][128] );
+  memset( &edid[2][256], 0, 128 );
+  edid[2][256] = 0x70;
+  xcmTestDisplayID( &edid[2][257], 0, 0 );
+  xcmTestChecksum( &edid[2][256] );
+  /* a empty text field */
+  xcmTestText( &edid[0][72], 255, "" );
+  xcmTestChecksum( edid[0] );
+
+  XCM_TEST( w != NULL );
+  for(i = 0; i < 3; ++i)
+  {
+    XCM_TEST( XcmEdidParseInto( edid[i], size[i], &info[i] ) ==
+              XCM_EDID_OK );
+    XCM_TEST( XcmEdidDbWriter_Add( w, &info[i] ) == XCM_EDID_OK );
+  }
+  XCM_TEST( XcmEdidDbWriter_Save( w, file_name ) == XCM_EDID_OK );
+  XcmEdidDbWriter_Release( &w );
+  XCM_TEST( w == NULL );
+
+  XCM_TEST( XcmEdidDb_Open( file_name, &db ) == XCM_EDID_OK );
+  XCM_TEST( XcmEdidDb_Count( db ) == 3 );
+  for(i = 0; i < 3; ++i)
+  {
+    /* XcmEdidParseInto() clears the padding as well */
+    XCM_TEST( XcmEdidDb_GetInfo( db, i, &back ) == XCM_EDID_OK );
+    XCM_TEST( memcmp( &back, &info[i], sizeof(back) ) == 0 );
+  }
+  r = XcmEdidDb_Get( db, 1 );
+  XCM_TEST( r && strcmp( XcmEdidDb_String( db, r->model ), "Display A" ) ==
+                 0 );
+  XCM_TEST( r && r->max_luminance == info[1].max_luminance );
+  r = XcmEdidDb_Get( db, 0 );
+  XCM_TEST( r && r->serial == 0 );
+  XCM_TEST( XcmEdidDb_Get( db, 3 ) == NULL );
+  XCM_TEST( XcmEdidDb_GetInfo( db, 3, &back ) == XCM_EDID_WRONG_ARGUMENT );
+  XcmEdidDb_Release( &db );
+  XCM_TEST( db == NULL );
+
+  /* a foreign file */
+  fp = fopen( file_name, "r+b" );
+  XCM_TEST( fp != NULL );
+  if(fp)
+  {
+    fputc( 'x', fp );
+    fclose( fp );
+  }
+  XCM_TEST( XcmEdidDb_Open( file_name, &db ) == XCM_EDID_WRONG_SIGNATURE );
+  XCM_TEST( db == NULL );
+  remove( file_name );
+  XCM_TEST( XcmEdidDb_Open( file_name, &db ) == XCM_EDID_FILE_FAIL );
+
+  /* no records */
+  w = XcmEdidDbWriter_New();
+  XCM_TEST( XcmEdidDbWriter_Save( w, file_name ) == XCM_EDID_OK );
+  XcmEdidDbWriter_Release( &w );
+  XCM_TEST( XcmEdidDb_Open( file_name, &db ) == XCM_EDID_OK );
+  XCM_TEST( XcmEdidDb_Count( db ) == 0 && XcmEdidDb_Get( db, 0 ) == NULL );
+  XcmEdidDb_Release( &db );
+  remove( file_name );
+}
+
+static const xcmTest_s xcm_tests[] = {
+  { "base", xcmTestParseBase },
+  { "cea", xcmTestParseCEA },
+  { "displayid", xcmTestParseDisplayID },
+  { "truncated", xcmTestParseTruncated },
+  { "db", xcmTestDbRoundTrip },
+  { NULL, NULL }
+};
+
+int main( int argc, char ** argv )
+{
+  return xcmTestMain( xcm_tests, argc, argv );
+}
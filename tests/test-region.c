@@ -0,0 +1,281 @@
+/*  @file test-region.c
+ *
+ *  libXcm  Xorg Colour Management
+ *
+ *  @par Copyright:
+ *            2026 (C) Kai-Uwe Behrmann
+ *
+ *  @brief    colour region stack unit tests
+ *  @internal
+ *  @author   Kai-Uwe Behrmann <ku.b@gmx.de>
+ *  @par License:
+ *            MIT <http://www.opensource.org/licenses/mit-license.php>
+ *  @since    2026/10/17
+ *
+ *  The Xlib calls of Xcm.c are replaced by stubs, which keep one window
+ *  property in memory and count the requests. No X server is needed.
+ */
+
+#include "Xcm.c"
+#include "xcm-test.h"
+
+#include <stdlib.h>
+
+int xcm_debug_ = 0;
+int * xcm_debug = &xcm_debug_;
+XcmMessage_f XcmMessage_p = NULL;
+
+#define XCM_TEST_REGIONS 16
+
+/* the _ICC_COLOR_REGIONS property and the requests on it */
+typedef struct {
+  XcolorRegion       regs[XCM_TEST_REGIONS * 2];
+  unsigned long      n;
+  int                gets;
+  int                changes;
+  int                deletes;
+  int                sends;
+  int                mode;             /* of the last XChangeProperty */
+} xcmTestWindow_s;
+
+static xcmTestWindow_s xcm_test_win;
+
+/* Xlib stubs */
+
+Atom XInternAtom( Display * dpy, _Xconst char * name, Bool only_if_exists )
+{ return 100 + strlen( name ); }
+
+Status XInternAtoms( Display * dpy, char ** names, int count, Bool only_if_exists,
+                     Atom * atoms )
+{
+  int i;
+  for(i = 0; i < count; ++i)
+    atoms[i] = 200 + i;
+  return 1;
+}
+
+static XExtCodes xcm_test_codes;
+XExtCodes * XAddExtension( Display * dpy )
+{ return &xcm_test_codes; }
+
+int (*XESetCloseDisplay( Display * dpy, int extension,
+                         int (*proc)( Display *, XExtCodes * ) ))
+                                                ( Display *, XExtCodes * )
+{ return NULL; }
+
+Status XSendEvent( Display * dpy, Window w, Bool propagate, long mask,
+                   XEvent * event )
+{ ++xcm_test_win.sends; return 1; }
+
+Status XGetWindowAttributes( Display * dpy, Window w, XWindowAttributes * xwa )
+{ xwa->root = 1; return 1; }
+
+int XGetWindowProperty( Display * dpy, Window w, Atom property, long offset,
+                        long length, Bool del, Atom req_type,
+                        Atom * actual_type, int * actual_format,
+                        unsigned long * n, unsigned long * after,
+                        unsigned char ** data )
+{
+  size_t size = xcm_test_win.n * sizeof(XcolorRegion);
+
+  ++xcm_test_win.gets;
+  *actual_type = XA_CARDINAL;
+  *actual_format = 8;
+  *n = size;
+  *after = 0;
+  *data = malloc( size + 1 );
+  memcpy( *data, xcm_test_win.regs, size );
+  return Success;
+}
+
+int XChangeProperty( Display * dpy, Window w, Atom property, Atom type,
+                     int format, int mode, _Xconst unsigned char * data,
+                     int size )
+{
+  unsigned long n = size / sizeof(XcolorRegion);
+
+  ++xcm_test_win.changes;
+  xcm_test_win.mode = mode;
+  if(xcm_test_win.n + n > XCM_TEST_REGIONS * 2)
+    return 0;
+
+  if(mode == PropModeReplace)
+    xcm_test_win.n = 0;
+  else if(mode == PropModePrepend)
+    memmove( &xcm_test_win.regs[n], xcm_test_win.regs,
+             xcm_test_win.n * sizeof(XcolorRegion) );
+  memcpy( &xcm_test_win.regs[mode == PropModeAppend ? xcm_test_win.n : 0],
+          data, size );
+  xcm_test_win.n += n;
+  return 1;
+}
+
+int XDeleteProperty( Display * dpy, Window w, Atom property )
+{ ++xcm_test_win.deletes; xcm_test_win.n = 0; return 1; }
+
+int XFree( void * data )
+{ free( data ); return 1; }
+
+int XFlush( Display * dpy )
+{ return 1; }
+
+Window XRootWindow( Display * dpy, int screen )
+{ return 1; }
+
+/* fixtures */
+
+static XcolorRegion xcm_test_regs[XCM_TEST_REGIONS];
+
+static Display *   xcmTestDisplay    ( void )
+{
+  static Display * dpy = NULL;
+  int i;
+
+  if(!dpy)
+  {
+    dpy = calloc( 1, sizeof(*dpy) );
+    dpy->screens = calloc( 1, sizeof(Screen) );
+    dpy->nscreens = 1;
+  }
+  for(i = 0; i < XCM_TEST_REGIONS; ++i)
+    xcm_test_regs[i].region = i;
+  memset( &xcm_test_win, 0, sizeof(xcm_test_win) );
+  return dpy;
+}
+
+/* compare the property with a list of region ids */
+static int         xcmTestStack      ( const char        * ids )
+{
+  unsigned long i, n = strlen( ids );
+
+  if(xcm_test_win.n != n)
+    return 0;
+  for(i = 0; i < n; ++i)
+    if(xcm_test_win.regs[i].region != (uint32_t)(ids[i] - '0'))
+      return 0;
+  return 1;
+}
+
+static void        xcmTestResetCounts( void )
+{
+  xcm_test_win.gets = xcm_test_win.changes = xcm_test_win.deletes =
+  xcm_test_win.sends = 0;
+}
+
+/* tests */
+
+/* prepends and appends go out without reading the stack; positions inside
+ * need the stack and the end is the limit */
+static void        xcmTestInsert     ( void )
+{
+  Display * dpy = xcmTestDisplay();
+  XcolorRegion * r = xcm_test_regs;
+
+  XCM_TEST( XcolorRegionInsert( dpy, 5, XCM_COLOR_REGIONS_END, r, 2 ) == 0 );
+  XCM_TEST( XcolorRegionInsert( dpy, 5, XCM_COLOR_REGIONS_END, r+2, 2 ) == 0 );
+  XCM_TEST( xcmTestStack( "0123" ) );
+  XCM_TEST( xcm_test_win.gets == 0 && xcm_test_win.changes == 2 );
+  XCM_TEST( xcm_test_win.mode == PropModeAppend );
+
+  xcmTestResetCounts();
+  XCM_TEST( XcolorRegionInsert( dpy, 5, XCM_COLOR_REGIONS_START, r+4, 1 )
+            == 0 );
+  XCM_TEST( xcmTestStack( "40123" ) );
+  XCM_TEST( xcm_test_win.gets == 0 && xcm_test_win.mode == PropModePrepend );
+  /* a plain 0 reads and replaces the stack, whatever its type */
+  XCM_TEST( XcolorRegionInsert( dpy, 5, 0, r+9, 1 ) == 0 );
+  XCM_TEST( xcmTestStack( "940123" ) );
+  XCM_TEST( xcm_test_win.gets == 1 && xcm_test_win.mode == PropModeReplace );
+  XCM_TEST( XcolorRegionDelete( dpy, 5, 0, 2 ) == 0 );
+
+  xcmTestResetCounts();
+  XCM_TEST( XcolorRegionInsert( dpy, 5, 2, r+5, 1 ) == 0 );
+  XCM_TEST( xcmTestStack( "01523" ) );
+  XCM_TEST( XcolorRegionInsert( dpy, 5, 5, r+6, 1 ) == 0 );
+  XCM_TEST( xcmTestStack( "015236" ) );
+  XCM_TEST( xcm_test_win.gets == 2 && xcm_test_win.mode == PropModeReplace );
+
+  xcmTestResetCounts();
+  XCM_TEST( XcolorRegionInsert( dpy, 5, 7, r, 1 ) == -1 );
+  XCM_TEST( xcmTestStack( "015236" ) && xcm_test_win.changes == 0 );
+
+  XCM_TEST( XcolorRegionDelete( dpy, 5, 1, 2 ) == 0 );
+  XCM_TEST( xcmTestStack( "0236" ) );
+  XCM_TEST( XcolorRegionDelete( dpy, 5, 3, 2 ) == -1 );
+  XCM_TEST( XcolorRegionDelete( dpy, 5, 0, 4 ) == 0 );
+  XCM_TEST( xcm_test_win.n == 0 && xcm_test_win.deletes == 1 );
+}
+
+/* edits change the local copy only; commit writes the result once */
+static void        xcmTestTransaction( void )
+{
+  Display * dpy = xcmTestDisplay();
+  XcolorRegion * r = xcm_test_regs, * regs;
+  XcolorRegionTransaction * t;
+  unsigned long n = 0;
+
+  XcolorRegionInsert( dpy, 5, XCM_COLOR_REGIONS_END, r, 3 );
+  xcmTestResetCounts();
+
+  t = XcolorRegionTransactionBegin( dpy, 5 );
+  XCM_TEST( t != NULL && xcm_test_win.gets == 1 );
+  XCM_TEST( XcolorRegionTransactionInsert( t, 3, r+3, 3 ) == 0 );     /* 012345 */
+  XCM_TEST( XcolorRegionTransactionInsert( t, XCM_COLOR_REGIONS_START, r+9, 1 )
+            == 0 );                                                   /* 9012345 */
+  XCM_TEST( XcolorRegionTransactionInsert( t, 8, r, 1 ) == -1 );
+  XCM_TEST( XcolorRegionTransactionDelete( t, 2, 1 ) == 0 );          /* 902345 */
+  XCM_TEST( XcolorRegionTransactionDelete( t, 5, 2 ) == -1 );
+  XCM_TEST( XcolorRegionTransactionMove( t, 0, 2, 3 ) == 0 );         /* 234905 */
+  XCM_TEST( XcolorRegionTransactionMove( t, 4, 2, 0 ) == 0 );         /* 052349 */
+  XCM_TEST( XcolorRegionTransactionMove( t, 0, 2, 5 ) == -1 );
+  XCM_TEST( XcolorRegionTransactionInsert( t, XCM_COLOR_REGIONS_END, r+7, 1 )
+            == 0 );                                                   /* 0523497 */
+
+  XCM_TEST( XcolorRegionTransactionRegions( t, NULL ) != NULL );
+  XCM_TEST( XcolorRegionTransactionRegions( NULL, NULL ) == NULL );
+  regs = XcolorRegionTransactionRegions( t, &n );
+  XCM_TEST( n == 7 && regs && regs[6].region == 7 );
+  XCM_TEST( xcm_test_win.gets == 1 && xcm_test_win.changes == 0 );
+  XCM_TEST( xcmTestStack( "012" ) );
+
+  XCM_TEST( XcolorRegionTransactionCommit( t, 1 ) == 0 );
+  XCM_TEST( xcmTestStack( "0523497" ) );
+  XCM_TEST( xcm_test_win.gets == 1 && xcm_test_win.changes == 1 );
+  XCM_TEST( xcm_test_win.mode == PropModeReplace );
+  XCM_TEST( xcm_test_win.sends == 1 );
+
+  /* nothing changed, nothing written */
+  xcmTestResetCounts();
+  t = XcolorRegionTransactionBegin( dpy, 5 );
+  XCM_TEST( XcolorRegionTransactionMove( t, 1, 2, 1 ) == 0 );
+  XCM_TEST( XcolorRegionTransactionCommit( t, 0 ) == 0 );
+  XCM_TEST( xcm_test_win.changes == 0 && xcm_test_win.sends == 0 );
+
+  /* an emptied stack removes the property */
+  t = XcolorRegionTransactionBegin( dpy, 5 );
+  XCM_TEST( XcolorRegionTransactionDelete( t, 0, 7 ) == 0 );
+  XCM_TEST( XcolorRegionTransactionCommit( t, 0 ) == 0 );
+  XCM_TEST( xcm_test_win.n == 0 && xcm_test_win.deletes == 1 );
+  XCM_TEST( xcm_test_win.changes == 0 );
+
+  /* growing beyond the fetched stack */
+  t = XcolorRegionTransactionBegin( dpy, 5 );
+  for(n = 0; n < XCM_TEST_REGIONS; ++n)
+    XCM_TEST( XcolorRegionTransactionInsert( t, n / 2, &r[n], 1 ) == 0 );
+  regs = XcolorRegionTransactionRegions( t, &n );
+  XCM_TEST( n == XCM_TEST_REGIONS && regs[0].region == 1 &&
+            regs[XCM_TEST_REGIONS - 1].region == 0 );
+  XcolorRegionTransactionAbort( t );
+  XCM_TEST( xcm_test_win.n == 0 );
+}
+
+static const xcmTest_s xcm_tests[] = {
+  { "insert", xcmTestInsert },
+  { "transaction", xcmTestTransaction },
+  { NULL, NULL }
+};
+
+int main( int argc, char ** argv )
+{
+  return xcmTestMain( xcm_tests, argc, argv );
+}
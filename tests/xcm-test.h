@@ -0,0 +1,60 @@
+/*  @file xcm-test.h
+ *
+ *  libXcm  Xorg Colour Management
+ *
+ *  @par Copyright:
+ *            2026 (C) Kai-Uwe Behrmann
+ *
+ *  @brief    minimal check macros for the unit tests
+ *  @internal
+ *  @author   Kai-Uwe Behrmann <ku.b@gmx.de>
+ *  @par License:
+ *            MIT <http://www.opensource.org/licenses/mit-license.php>
+ *  @since    2026/10/17
+ */
+
+#ifndef __XCM_TEST_H__
+#define __XCM_TEST_H__
+
+#include <stdio.h>
+#include <string.h>
+
+static int xcm_test_failures = 0;
+
+/* report a failed condition and go on with the test */
+#define XCM_TEST( cond ) do { if(!(cond)) { \
+  fprintf( stderr, "%s:%d: %s\n", __FILE__, __LINE__, #cond ); \
+  ++xcm_test_failures; } } while(0)
+
+typedef struct {
+  const char * name;
+  void      (* run)(void);
+} xcmTest_s;
+
+/* run the test named in argv[1] or all; returns the exit code */
+static int         xcmTestMain       ( const xcmTest_s   * tests,
+                                       int                 argc,
+                                       char             ** argv )
+{
+  int i, found = 0;
+
+  for(i = 0; tests[i].name; ++i)
+    if(argc < 2 || strcmp( argv[1], tests[i].name ) == 0)
+    {
+      int failures = xcm_test_failures;
+      tests[i].run();
+      fprintf( stderr, "%s: %s\n", tests[i].name,
+               failures == xcm_test_failures ? "ok" : "FAILED" );
+      found = 1;
+    }
+
+  if(!found)
+  {
+    fprintf( stderr, "unknown test: %s\n", argv[1] );
+    return 1;
+  }
+
+  return xcm_test_failures ? 1 : 0;
+}
+
+#endif /* __XCM_TEST_H__ */